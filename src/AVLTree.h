@@ -10,6 +10,9 @@
 #define SearchTrees_AVLTree_h
 
 #include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 template<typename KeyType, typename ValueType>
 class AVLTree {
@@ -42,6 +45,15 @@ private:
         return ret;
     }
 
+    // HELPER: Comparaison a trois issues, negative si a < b, nulle si a == b,
+    // positive si a > b. Une seule comparaison de chaines par noeud visite.
+    static int compare(const KeyType &a, const KeyType &b) {
+        if constexpr (std::is_same<KeyType, std::string>::value)
+            return a.compare(b);
+        else
+            return (a < b) ? -1 : (b < a) ? 1 : 0;
+    }
+
     // HELPER: Mise à jour de la taille d'un sous-arbre à partir des taille de ses enfants
     void updateNodeSize(Node *x) {
         x->nodeSize = size(x->right) + size(x->left) + 1;
@@ -109,16 +121,30 @@ private:
         delete x;
     }
 
+    //
+    // Efface tous les elements
+    //
+public:
+    void clear() {
+        deleteSubTree(root);
+        root = nullptr;
+    }
+
     //
     // Nombre d'elements
     //
 public:
-    int size() {
+    int size() const {
         return size(root);
     }
 
+    //
+    // Taille d'un noeud, en octets
+    //
+    static constexpr size_t NODE_SIZE = sizeof(Node);
+
 private:
-    int size(Node *x) {
+    static int size(Node *x) {
         return (x == nullptr) ? 0 : x->nodeSize;
     }
 
@@ -135,9 +161,10 @@ private:
         if (x == nullptr)
             return new Node(key, value);
 
-        if (key < x->key)
+        const int order = compare(key, x->key);
+        if (order < 0)
             x->left = put(x->left, key, value);
-        else if (key > x->key)
+        else if (order > 0)
             x->right = put(x->right, key, value);
         else // x->key == key
             x->value = value;
@@ -147,6 +174,32 @@ private:
         return restoreBalance(x);  // AVL. sinon on aurait return x;
     }
 
+    //
+    // Construction en O(n) d'un arbre equilibre a partir de cles triees et
+    // sans doublon, toutes associees a value. Remplace le contenu actuel.
+    //
+public:
+    void build(const std::vector<KeyType> &keys, const ValueType &value) {
+        clear();
+        root = build(keys, 0, keys.size(), value);
+    }
+
+private:
+    Node *build(const std::vector<KeyType> &keys, size_t begin, size_t end,
+                const ValueType &value) {
+        if (begin == end)
+            return nullptr;
+
+        // La cle mediane est la racine, les deux moities ses sous-arbres.
+        const size_t middle = begin + (end - begin) / 2;
+        Node *x = new Node(keys[middle], value);
+        x->left = build(keys, begin, middle, value);
+        x->right = build(keys, middle + 1, end, value);
+        updateNodeSize(x);
+        updateNodeHeight(x);
+        return x;
+    }
+
     //
     // AVL: calcul et restoration de l'équilibre d'un noeud.
     //
@@ -177,12 +230,13 @@ private:
     // ne modifie pas value sinon.
     //
 public:
-    bool get(const KeyType &key, ValueType &value) {
+    bool get(const KeyType &key, ValueType &value) const {
         Node *x = root;
         while (x != nullptr) {
-            if (key < x->key)
+            const int order = compare(key, x->key);
+            if (order < 0)
                 x = x->left;
-            else if (key > x->key)
+            else if (order > 0)
                 x = x->right;
             else // x->key == key.
             {
@@ -196,12 +250,13 @@ public:
     //
     // idem précédent, mais sans retour de la valeur
     //
-    bool contains(const KeyType &key) {
+    bool contains(const KeyType &key) const {
         Node *x = root;
         while (x != nullptr) {
-            if (key < x->key)
+            const int order = compare(key, x->key);
+            if (order < 0)
                 x = x->left;
-            else if (key > x->key)
+            else if (order > 0)
                 x = x->right;
             else // x->key == key.
                 return true;
@@ -214,12 +269,12 @@ public:
     // Profondeur de l'arbre.
     //
 public:
-    int height() {
+    int height() const {
         return height(root);
     }
 
 private:
-    int height(Node *x) {
+    static int height(Node *x) {
         if (x == nullptr)
             return -1;
         return x->nodeHeight;
@@ -252,7 +307,7 @@ private:
 public:
     void deleteMax() {
         if (root != nullptr) {
-            root = deleteMin(root);
+            root = deleteMax(root);
         }
     }
 
@@ -260,7 +315,7 @@ private:
     Node *deleteMax(Node *x) {
         if (x->right == nullptr)
             return deleteAndReturn(x, x->left);
-        x->left = deleteMin(x->right);
+        x->right = deleteMax(x->right);
         x->nodeSize--;
         return restoreBalance(x);
     }
@@ -279,9 +334,10 @@ private:
         if (x == nullptr)
             return nullptr; // element pas trouve.
 
-        if (key < x->key)
+        const int order = compare(key, x->key);
+        if (order < 0)
             x->left = deleteElement(x->left, key);
-        else if (key > x->key)
+        else if (order > 0)
             x->right = deleteElement(x->right, key);
         else { // x->key == key
             if (x->right == nullptr)
@@ -303,14 +359,14 @@ private:
     //
 public:
     template<typename Fn>
-    void visitInOrder(Fn f) {
+    void visitInOrder(Fn f) const {
         if (root != nullptr)
             visitInOrder(root, f);
     }
 
 private:
     template<typename Fn>
-    void visitInOrder(Node *x, Fn f) {
+    static void visitInOrder(Node *x, Fn f) {
         if (x->left != nullptr)
             visitInOrder(x->left, f);
 
@@ -356,20 +412,41 @@ private:
     // Renvoie le rang (nombre de cles plus petites) d'une cle
     //
 public:
-    int rank(const KeyType &key) {
+    int rank(const KeyType &key) const {
         return rank(root, key);
     }
 
 private:
-    int rank(Node *x, const KeyType &key) {
+    static int rank(Node *x, const KeyType &key) {
         if (x == nullptr) return 0;
 
-        if (key < x->key)
+        const int order = compare(key, x->key);
+        if (order < 0)
             return rank(x->left, key);
-        else if (key > x->key)
+        else if (order > 0)
             return 1 + size(x->left) + rank(x->right, key);
         else return size(x->left);
     }
+
+    //
+    // Renvoie la clé de rang rank. Permet de mettre en oeuvre un
+    // operator [] par exemple.
+    //
+public:
+    KeyType select(int rank) const { // 0 <= rank < size()
+        return select(root, rank)->key;
+    }
+
+private:
+    static Node *select(Node *x, int rank) {
+        int r = size(x->left);
+        if (r > rank)
+            return select(x->left, rank);
+        else if (r < rank)
+            return select(x->right, rank - r - 1);
+        else // r == rank
+            return x;
+    }
 };
 
 
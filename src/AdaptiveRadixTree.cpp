@@ -0,0 +1,625 @@
+/**
+*  @file AdaptiveRadixTree.cpp
+*  @brief Modélise un arbre radix adaptatif (Adaptive Radix Tree) contenant
+*         un ensemble de mots.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "AdaptiveRadixTree.h"
+
+AdaptiveRadixTree::AdaptiveRadixTree() : root(nullptr) {
+    clear();
+}
+
+AdaptiveRadixTree::~AdaptiveRadixTree() {
+    destroy(root);
+}
+
+bool AdaptiveRadixTree::insert(const std::string &word) {
+    Node **link = &root;
+    size_t depth = 0;
+
+    while (*link) {
+        Node *node = *link;
+
+        // Deux mots se séparent sous la feuille : un Node4 la remplace.
+        if (isLeaf(node)) {
+            if (matches(node, word))
+                return false;
+
+            const Leaf *leaf = asLeaf(node);
+            Node4 *parent = allocate<Node4>(NODE4);
+
+            size_t i = depth;
+            while (keyAt(leaf->key(), leaf->length, i) == keyAt(word.data(), word.length(), i))
+                ++i;
+
+            parent->prefixLength = (uint32_t) (i - depth);
+            for (size_t j = 0; j < std::min(MAX_PREFIX, i - depth); ++j)
+                parent->prefix[j] = (uint8_t) word[depth + j];
+
+            *link = parent;
+            addChild(link, keyAt(leaf->key(), leaf->length, i), node);
+            addChild(link, keyAt(word.data(), word.length(), i), makeLeaf(word));
+
+            return true;
+        }
+
+        // Le mot quitte le préfixe du noeud : un Node4 le coupe en deux.
+        if (node->prefixLength) {
+            const size_t COMMON = prefixMismatch(node, word, depth);
+
+            if (COMMON < node->prefixLength) {
+                Node4 *parent = allocate<Node4>(NODE4);
+                parent->prefixLength = (uint32_t) COMMON;
+                std::memcpy(parent->prefix, node->prefix, std::min(MAX_PREFIX, COMMON));
+
+                uint8_t c;
+                node->prefixLength -= (uint32_t) (COMMON + 1);
+
+                if (node->prefixLength + COMMON + 1 <= MAX_PREFIX) {
+                    c = node->prefix[COMMON];
+                    std::memmove(node->prefix, node->prefix + COMMON + 1,
+                                 node->prefixLength);
+                } else {
+                    // La suite du préfixe n'est connue que des feuilles.
+                    const Leaf *leaf = anyLeaf(node);
+                    c = keyAt(leaf->key(), leaf->length, depth + COMMON);
+
+                    for (size_t j = 0; j < std::min<size_t>(MAX_PREFIX, node->prefixLength); ++j)
+                        node->prefix[j] = keyAt(leaf->key(), leaf->length,
+                                                depth + COMMON + 1 + j);
+                }
+
+                *link = parent;
+                addChild(link, c, node);
+                addChild(link, keyAt(word.data(), word.length(), depth + COMMON),
+                         makeLeaf(word));
+
+                return true;
+            }
+
+            depth += node->prefixLength;
+        }
+
+        const uint8_t c = keyAt(word.data(), word.length(), depth);
+        Node **child = findChild(node, c);
+
+        if (!child) {
+            addChild(link, c, makeLeaf(word));
+            return true;
+        }
+
+        link = child;
+        ++depth;
+    }
+
+    *link = makeLeaf(word);
+    return true;
+}
+
+bool AdaptiveRadixTree::remove(const std::string &word) {
+    Node **link = &root;
+    size_t depth = 0;
+
+    if (!root)
+        return false;
+
+    if (isLeaf(root)) {
+        if (!matches(root, word))
+            return false;
+
+        freeLeaf(root);
+        root = nullptr;
+        return true;
+    }
+
+    while (true) {
+        Node *node = *link;
+
+        if (node->prefixLength) {
+            if (prefixMismatch(node, word, depth) < node->prefixLength)
+                return false;
+
+            depth += node->prefixLength;
+        }
+
+        if (depth > word.length())
+            return false;
+
+        const uint8_t c = keyAt(word.data(), word.length(), depth);
+        Node **child = findChild(node, c);
+
+        if (!child)
+            return false;
+
+        if (isLeaf(*child)) {
+            if (!matches(*child, word))
+                return false;
+
+            freeLeaf(*child);
+            removeChild(link, c, child);
+            return true;
+        }
+
+        link = child;
+        ++depth;
+    }
+}
+
+bool AdaptiveRadixTree::contains(const std::string &word) const {
+    const Node *node = root;
+    size_t depth = 0;
+
+    while (node) {
+        if (isLeaf(node))
+            return matches(node, word);
+
+        // Seul le début du préfixe est vérifié, la feuille confirme le reste.
+        if (node->prefixLength) {
+            const size_t LENGTH = std::min<size_t>(MAX_PREFIX, node->prefixLength);
+
+            for (size_t i = 0; i < LENGTH; ++i)
+                if (node->prefix[i] != keyAt(word.data(), word.length(), depth + i))
+                    return false;
+
+            depth += node->prefixLength;
+        }
+
+        if (depth > word.length())
+            return false;
+
+        Node **child = findChild(const_cast<Node *>(node),
+                                 keyAt(word.data(), word.length(), depth));
+        node = child ? *child : nullptr;
+        ++depth;
+    }
+
+    return false;
+}
+
+void AdaptiveRadixTree::clear() {
+    destroy(root);
+    root = nullptr;
+
+    pool4.clear();
+    pool16.clear();
+    pool48.clear();
+    pool256.clear();
+
+    std::fill(nodes, nodes + 4, 0);
+    keys = 0;
+    leafBytes = 0;
+}
+
+size_t AdaptiveRadixTree::size() const {
+    return keys;
+}
+
+size_t AdaptiveRadixTree::countNodes(size_t children) const {
+    switch (children) {
+        case 4:
+            return nodes[NODE4];
+        case 16:
+            return nodes[NODE16];
+        case 48:
+            return nodes[NODE48];
+        case 256:
+            return nodes[NODE256];
+        default:
+            return 0;
+    }
+}
+
+size_t AdaptiveRadixTree::memoryUsage() const {
+    return pool4.capacity() * sizeof(Node4)
+           + pool16.capacity() * sizeof(Node16)
+           + pool48.capacity() * sizeof(Node48)
+           + pool256.capacity() * sizeof(Node256)
+           + leafBytes;
+}
+
+bool AdaptiveRadixTree::matches(const Node *leaf, const std::string &word) {
+    const Leaf *l = asLeaf(leaf);
+    return l->length == word.length()
+           && std::memcmp(l->key(), word.data(), word.length()) == 0;
+}
+
+AdaptiveRadixTree::Node **AdaptiveRadixTree::findChild(Node *node, uint8_t c) {
+    switch (node->type) {
+        case NODE4: {
+            Node4 *n = static_cast<Node4 *>(node);
+            for (size_t i = 0; i < n->count; ++i)
+                if (n->keys[i] == c)
+                    return &n->children[i];
+
+            return nullptr;
+        }
+        case NODE16: {
+            Node16 *n = static_cast<Node16 *>(node);
+#ifdef __SSE2__
+            // Compare les 16 octets d'un coup, les cases vides sont masquées.
+            const __m128i KEYS = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys));
+            const int MASK = _mm_movemask_epi8(_mm_cmpeq_epi8(KEYS, _mm_set1_epi8((char) c)))
+                             & ((1 << n->count) - 1);
+
+            return MASK ? &n->children[__builtin_ctz(MASK)] : nullptr;
+#else
+            for (size_t i = 0; i < n->count; ++i)
+                if (n->keys[i] == c)
+                    return &n->children[i];
+
+            return nullptr;
+#endif
+        }
+        case NODE48: {
+            Node48 *n = static_cast<Node48 *>(node);
+            return n->index[c] ? &n->children[n->index[c] - 1] : nullptr;
+        }
+        default: {
+            Node256 *n = static_cast<Node256 *>(node);
+            return n->children[c] ? &n->children[c] : nullptr;
+        }
+    }
+}
+
+const AdaptiveRadixTree::Leaf *AdaptiveRadixTree::anyLeaf(const Node *node) {
+    while (!isLeaf(node)) {
+        switch (node->type) {
+            case NODE4:
+                node = static_cast<const Node4 *>(node)->children[0];
+                break;
+            case NODE16:
+                node = static_cast<const Node16 *>(node)->children[0];
+                break;
+            case NODE48: {
+                const Node48 *n = static_cast<const Node48 *>(node);
+                size_t c = 0;
+                while (!n->index[c])
+                    ++c;
+
+                node = n->children[n->index[c] - 1];
+                break;
+            }
+            default: {
+                const Node256 *n = static_cast<const Node256 *>(node);
+                size_t c = 0;
+                while (!n->children[c])
+                    ++c;
+
+                node = n->children[c];
+                break;
+            }
+        }
+    }
+
+    return asLeaf(node);
+}
+
+size_t AdaptiveRadixTree::prefixMismatch(const Node *node, const std::string &word,
+                                         size_t depth) {
+    const size_t LENGTH = std::min<size_t>(MAX_PREFIX, node->prefixLength);
+    size_t i = 0;
+
+    for (; i < LENGTH; ++i)
+        if (node->prefix[i] != keyAt(word.data(), word.length(), depth + i))
+            return i;
+
+    if (node->prefixLength > MAX_PREFIX) {
+        const Leaf *leaf = anyLeaf(node);
+
+        for (; i < node->prefixLength; ++i)
+            if (keyAt(leaf->key(), leaf->length, depth + i)
+                != keyAt(word.data(), word.length(), depth + i))
+                return i;
+    }
+
+    return i;
+}
+
+AdaptiveRadixTree::Node *AdaptiveRadixTree::makeLeaf(const std::string &word) {
+    const size_t BYTES = sizeof(Leaf) + word.length();
+    Leaf *leaf = static_cast<Leaf *>(std::malloc(BYTES));
+
+    leaf->length = (uint32_t) word.length();
+    std::memcpy(leaf + 1, word.data(), word.length());
+
+    leafBytes += BYTES;
+    ++keys;
+
+    return tagLeaf(leaf);
+}
+
+void AdaptiveRadixTree::freeLeaf(Node *leaf) {
+    Leaf *l = asLeaf(leaf);
+
+    leafBytes -= sizeof(Leaf) + l->length;
+    --keys;
+
+    std::free(l);
+}
+
+template<typename NodeT>
+NodeT *AdaptiveRadixTree::allocate(NodeType type) {
+    NodeT *node;
+
+    switch (type) {
+        case NODE4:
+            node = reinterpret_cast<NodeT *>(pool4.allocate());
+            break;
+        case NODE16:
+            node = reinterpret_cast<NodeT *>(pool16.allocate());
+            break;
+        case NODE48:
+            node = reinterpret_cast<NodeT *>(pool48.allocate());
+            break;
+        default:
+            node = reinterpret_cast<NodeT *>(pool256.allocate());
+            break;
+    }
+
+    node->type = type;
+    ++nodes[type];
+
+    return node;
+}
+
+void AdaptiveRadixTree::deallocate(Node *node) {
+    --nodes[node->type];
+
+    switch (node->type) {
+        case NODE4:
+            pool4.deallocate(static_cast<Node4 *>(node));
+            break;
+        case NODE16:
+            pool16.deallocate(static_cast<Node16 *>(node));
+            break;
+        case NODE48:
+            pool48.deallocate(static_cast<Node48 *>(node));
+            break;
+        default:
+            pool256.deallocate(static_cast<Node256 *>(node));
+            break;
+    }
+}
+
+namespace {
+    /**
+    * @fn template <typename Target, typename Source>
+    *     void copyHeader(Target* target, const Source* source)
+    * @brief Copie le nombre d'enfants et le préfixe d'un noeud.
+    */
+    template<typename Target, typename Source>
+    void copyHeader(Target *target, const Source *source) {
+        target->count = source->count;
+        target->prefixLength = source->prefixLength;
+        std::memcpy(target->prefix, source->prefix, sizeof(source->prefix));
+    }
+}
+
+void AdaptiveRadixTree::addChild(Node **link, uint8_t c, Node *child) {
+    Node *node = *link;
+
+    switch (node->type) {
+        case NODE4: {
+            Node4 *n = static_cast<Node4 *>(node);
+
+            if (n->count < 4) {
+                n->keys[n->count] = c;
+                n->children[n->count++] = child;
+                return;
+            }
+
+            Node16 *grown = allocate<Node16>(NODE16);
+            copyHeader(grown, n);
+            std::copy(n->keys, n->keys + 4, grown->keys);
+            std::copy(n->children, n->children + 4, grown->children);
+
+            deallocate(n);
+            *link = grown;
+            addChild(link, c, child);
+            return;
+        }
+        case NODE16: {
+            Node16 *n = static_cast<Node16 *>(node);
+
+            if (n->count < 16) {
+                n->keys[n->count] = c;
+                n->children[n->count++] = child;
+                return;
+            }
+
+            Node48 *grown = allocate<Node48>(NODE48);
+            copyHeader(grown, n);
+            for (uint8_t i = 0; i < 16; ++i) {
+                grown->index[n->keys[i]] = i + 1;
+                grown->children[i] = n->children[i];
+            }
+
+            deallocate(n);
+            *link = grown;
+            addChild(link, c, child);
+            return;
+        }
+        case NODE48: {
+            Node48 *n = static_cast<Node48 *>(node);
+
+            if (n->count < 48) {
+                uint8_t position = 0;
+                while (n->children[position])
+                    ++position;
+
+                n->index[c] = position + 1;
+                n->children[position] = child;
+                ++n->count;
+                return;
+            }
+
+            Node256 *grown = allocate<Node256>(NODE256);
+            copyHeader(grown, n);
+            for (size_t i = 0; i < 256; ++i)
+                if (n->index[i])
+                    grown->children[i] = n->children[n->index[i] - 1];
+
+            deallocate(n);
+            *link = grown;
+            addChild(link, c, child);
+            return;
+        }
+        default: {
+            Node256 *n = static_cast<Node256 *>(node);
+            n->children[c] = child;
+            ++n->count;
+            return;
+        }
+    }
+}
+
+void AdaptiveRadixTree::removeChild(Node **link, uint8_t c, Node **child) {
+    Node *node = *link;
+
+    switch (node->type) {
+        case NODE4: {
+            Node4 *n = static_cast<Node4 *>(node);
+            const size_t I = child - n->children;
+
+            std::copy(n->keys + I + 1, n->keys + n->count, n->keys + I);
+            std::copy(n->children + I + 1, n->children + n->count, n->children + I);
+            --n->count;
+
+            if (n->count > 1)
+                return;
+
+            // Un seul enfant : il prend la place du noeud, son préfixe est
+            // précédé de celui du noeud et de l'octet qui y menait.
+            Node *last = n->children[0];
+
+            if (!isLeaf(last)) {
+                uint8_t prefix[MAX_PREFIX];
+                size_t length = std::min<size_t>(MAX_PREFIX, n->prefixLength);
+                std::memcpy(prefix, n->prefix, length);
+
+                if (length < MAX_PREFIX)
+                    prefix[length++] = n->keys[0];
+
+                const size_t REST = std::min<size_t>(MAX_PREFIX - length, last->prefixLength);
+                std::memcpy(prefix + length, last->prefix, REST);
+                length += REST;
+
+                std::memcpy(last->prefix, prefix, length);
+                last->prefixLength += n->prefixLength + 1;
+            }
+
+            deallocate(n);
+            *link = last;
+            return;
+        }
+        case NODE16: {
+            Node16 *n = static_cast<Node16 *>(node);
+            const size_t I = child - n->children;
+
+            std::copy(n->keys + I + 1, n->keys + n->count, n->keys + I);
+            std::copy(n->children + I + 1, n->children + n->count, n->children + I);
+            --n->count;
+
+            if (n->count > 3)
+                return;
+
+            Node4 *shrunk = allocate<Node4>(NODE4);
+            copyHeader(shrunk, n);
+            std::copy(n->keys, n->keys + n->count, shrunk->keys);
+            std::copy(n->children, n->children + n->count, shrunk->children);
+
+            deallocate(n);
+            *link = shrunk;
+            return;
+        }
+        case NODE48: {
+            Node48 *n = static_cast<Node48 *>(node);
+
+            n->children[n->index[c] - 1] = nullptr;
+            n->index[c] = 0;
+            --n->count;
+
+            if (n->count > 12)
+                return;
+
+            Node16 *shrunk = allocate<Node16>(NODE16);
+            copyHeader(shrunk, n);
+
+            size_t count = 0;
+            for (size_t i = 0; i < 256; ++i)
+                if (n->index[i]) {
+                    shrunk->keys[count] = (uint8_t) i;
+                    shrunk->children[count++] = n->children[n->index[i] - 1];
+                }
+
+            deallocate(n);
+            *link = shrunk;
+            return;
+        }
+        default: {
+            Node256 *n = static_cast<Node256 *>(node);
+
+            n->children[c] = nullptr;
+            --n->count;
+
+            if (n->count > 37)
+                return;
+
+            Node48 *shrunk = allocate<Node48>(NODE48);
+            copyHeader(shrunk, n);
+
+            uint8_t count = 0;
+            for (size_t i = 0; i < 256; ++i)
+                if (n->children[i]) {
+                    shrunk->index[i] = ++count;
+                    shrunk->children[count - 1] = n->children[i];
+                }
+
+            deallocate(n);
+            *link = shrunk;
+            return;
+        }
+    }
+}
+
+void AdaptiveRadixTree::destroy(Node *node) {
+    if (!node)
+        return;
+
+    if (isLeaf(node)) {
+        freeLeaf(node);
+        return;
+    }
+
+    switch (node->type) {
+        case NODE4:
+            for (size_t i = 0; i < node->count; ++i)
+                destroy(static_cast<Node4 *>(node)->children[i]);
+            break;
+        case NODE16:
+            for (size_t i = 0; i < node->count; ++i)
+                destroy(static_cast<Node16 *>(node)->children[i]);
+            break;
+        case NODE48:
+            for (size_t i = 0; i < 48; ++i)
+                destroy(static_cast<Node48 *>(node)->children[i]);
+            break;
+        default:
+            for (size_t i = 0; i < 256; ++i)
+                destroy(static_cast<Node256 *>(node)->children[i]);
+            break;
+    }
+}
@@ -0,0 +1,288 @@
+/**
+*  @file AdaptiveRadixTree.h
+*  @brief Modélise un arbre radix adaptatif (Adaptive Radix Tree) contenant
+*         un ensemble de mots.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "MemoryPool.h"
+
+/**
+* Chaque noeud interne choisit un octet du mot parmi au plus 4, 16, 48 ou 256
+* enfants, et grandit ou rétrécit d'un type à l'autre selon son nombre
+* d'enfants. Les octets communs à tous les mots d'un sous-arbre sont
+* regroupés dans le préfixe du noeud (compression des chemins) ; seuls les
+* MAX_PREFIX premiers sont gardés, la suite est lue dans une feuille du
+* sous-arbre.
+*
+* Les feuilles gardent le mot entier et sont repérées par le bit de poids
+* faible de leur pointeur. Un octet nul termine chaque mot, afin qu'un mot
+* puisse être le début d'un autre.
+*/
+class AdaptiveRadixTree {
+public:
+    /**
+    * @fn AdaptiveRadixTree()
+    * @brief Constructeur d'un arbre vide.
+    */
+    AdaptiveRadixTree();
+
+    AdaptiveRadixTree(const AdaptiveRadixTree &) = delete;
+
+    AdaptiveRadixTree &operator=(const AdaptiveRadixTree &) = delete;
+
+    /**
+    * @fn ~AdaptiveRadixTree()
+    * @brief Destructeur d'un arbre, libération des feuilles.
+    */
+    ~AdaptiveRadixTree();
+
+    /**
+    * @fn bool insert(const std::string& word)
+    * @brief Ajoute un mot à l'arbre.
+    *
+    * @param[in] word     mot à ajouter, sans octet nul
+    *
+    * @return true si le mot a été ajouté, false si il était déjà présent.
+    */
+    bool insert(const std::string &word);
+
+    /**
+    * @fn bool remove(const std::string& word)
+    * @brief Supprime un mot de l'arbre. Les noeuds qui n'ont plus assez
+    *        d'enfants sont remplacés par un type plus petit, un noeud avec
+    *        un seul enfant est fusionné avec lui.
+    *
+    * @param[in] word     mot à supprimer
+    *
+    * @return true si le mot a été supprimé, false si il était absent.
+    */
+    bool remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est dans l'arbre.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est présent, false sinon.
+    */
+    bool contains(const std::string &word) const;
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu de l'arbre.
+    */
+    void clear();
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots de l'arbre.
+    *
+    * @return nombre de mots.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t countNodes(size_t children) const
+    * @brief Obtient le nombre de noeuds internes d'un type.
+    *
+    * @param[in] children   nombre maximal d'enfants du type : 4, 16, 48 ou 256
+    *
+    * @return nombre de noeuds du type.
+    */
+    size_t countNodes(size_t children) const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les noeuds et les feuilles.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    // Nombre d'octets du préfixe gardés dans un noeud
+    static constexpr size_t MAX_PREFIX = 8;
+
+    /**
+    * @var   enum NodeType
+    * @brief Type d'un noeud interne.
+    */
+    enum NodeType : uint8_t {
+        NODE4, NODE16, NODE48, NODE256
+    };
+
+    /**
+    * @var   struct Node
+    * @brief En-tête commun aux noeuds internes.
+    */
+    struct Node {
+        NodeType type;
+        uint16_t count;              // nombre d'enfants
+        uint32_t prefixLength;       // longueur du préfixe compressé
+        uint8_t prefix[MAX_PREFIX];  // début du préfixe
+    };
+
+    /**
+    * @var   struct Node4
+    * @brief Noeud d'au plus 4 enfants, aux octets non triés.
+    */
+    struct Node4 : Node {
+        uint8_t keys[4];
+        Node *children[4];
+    };
+
+    /**
+    * @var   struct Node16
+    * @brief Noeud d'au plus 16 enfants, aux octets comparés ensemble (SSE2).
+    */
+    struct Node16 : Node {
+        uint8_t keys[16];
+        Node *children[16];
+    };
+
+    /**
+    * @var   struct Node48
+    * @brief Noeud d'au plus 48 enfants, indexés par octet.
+    */
+    struct Node48 : Node {
+        uint8_t index[256];          // position de l'enfant + 1, 0 si absent
+        Node *children[48];
+    };
+
+    /**
+    * @var   struct Node256
+    * @brief Noeud avec une case par octet.
+    */
+    struct Node256 : Node {
+        Node *children[256];
+    };
+
+    /**
+    * @var   struct Leaf
+    * @brief Feuille, suivie des octets du mot.
+    */
+    struct Leaf {
+        uint32_t length;
+
+        const char *key() const {
+            return reinterpret_cast<const char *>(this + 1);
+        }
+    };
+
+    static bool isLeaf(const Node *node) {
+        return reinterpret_cast<uintptr_t>(node) & 1;
+    }
+
+    static Leaf *asLeaf(const Node *node) {
+        return reinterpret_cast<Leaf *>(reinterpret_cast<uintptr_t>(node) & ~(uintptr_t) 1);
+    }
+
+    static Node *tagLeaf(Leaf *leaf) {
+        return reinterpret_cast<Node *>(reinterpret_cast<uintptr_t>(leaf) | 1);
+    }
+
+    /**
+    * @fn static uint8_t keyAt(const char* key, size_t length, size_t depth)
+    * @brief Obtient l'octet d'un mot à une profondeur, 0 au-delà de sa fin.
+    */
+    static uint8_t keyAt(const char *key, size_t length, size_t depth) {
+        return depth < length ? (uint8_t) key[depth] : 0;
+    }
+
+    /**
+    * @fn static bool matches(const Node* leaf, const std::string& word)
+    * @brief Indique si une feuille porte le mot.
+    */
+    static bool matches(const Node *leaf, const std::string &word);
+
+    /**
+    * @fn static Node** findChild(Node* node, uint8_t c)
+    * @brief Obtient le lien vers l'enfant d'un octet, nul si il est absent.
+    */
+    static Node **findChild(Node *node, uint8_t c);
+
+    /**
+    * @fn static const Leaf* anyLeaf(const Node* node)
+    * @brief Obtient une feuille du sous-arbre, dont le mot commence par le
+    *        préfixe complet du noeud.
+    */
+    static const Leaf *anyLeaf(const Node *node);
+
+    /**
+    * @fn static size_t prefixMismatch(const Node* node,
+    *                                  const std::string& word, size_t depth)
+    * @brief Obtient la longueur commune au préfixe complet du noeud et au mot
+    *        à partir d'une profondeur.
+    */
+    static size_t prefixMismatch(const Node *node, const std::string &word,
+                                 size_t depth);
+
+    Node *makeLeaf(const std::string &word);
+
+    void freeLeaf(Node *leaf);
+
+    template<typename NodeT>
+    NodeT *allocate(NodeType type);
+
+    void deallocate(Node *node);
+
+    /**
+    * @fn void addChild(Node** link, uint8_t c, Node* child)
+    * @brief Ajoute un enfant au noeud d'un lien, remplacé par un type plus
+    *        grand si il est plein.
+    */
+    void addChild(Node **link, uint8_t c, Node *child);
+
+    /**
+    * @fn void removeChild(Node** link, uint8_t c, Node** child)
+    * @brief Retire un enfant du noeud d'un lien, remplacé par un type plus
+    *        petit si il en a trop peu.
+    */
+    void removeChild(Node **link, uint8_t c, Node **child);
+
+    /**
+    * @fn void destroy(Node* node)
+    * @brief Libère les feuilles d'un sous-arbre.
+    */
+    void destroy(Node *node);
+
+    /**
+    * @var   Node* root
+    * @brief Racine de l'arbre, nulle si il est vide.
+    */
+    Node *root;
+
+    MemoryPool<Node4, 4096> pool4;
+    MemoryPool<Node16, 1024> pool16;
+    MemoryPool<Node48, 256> pool48;
+    MemoryPool<Node256, 64> pool256;
+
+    /**
+    * @var   size_t nodes[4]
+    * @brief Nombre de noeuds internes de chaque type.
+    */
+    size_t nodes[4];
+
+    /**
+    * @var   size_t keys
+    * @brief Nombre de mots de l'arbre.
+    */
+    size_t keys;
+
+    /**
+    * @var   size_t leafBytes
+    * @brief Mémoire réservée par les feuilles.
+    */
+    size_t leafBytes;
+};
@@ -0,0 +1,333 @@
+/**
+*  @file BitParallelEngine.cpp
+*  @brief Modélise un moteur de suggestions qui compare le mot à tous les
+*         mots du dictionnaire de longueur voisine, avec l'algorithme
+*         bit-parallèle de Myers étendu aux inversions par Hyyrö.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "BitParallelEngine.h"
+#include "EditDistance.h"
+#include "Tools.h"
+
+namespace {
+    // Nombre de mots d'un bloc, un par octet d'un registre SSE2
+    const size_t LANES = 16;
+
+#ifdef __SSE2__
+    /**
+    * @fn template <typename Mask> __m128i broadcast(int value)
+    * @brief Obtient un registre dont chaque masque vaut la valeur.
+    */
+    template<typename Mask>
+    __m128i broadcast(int value) {
+        if constexpr (sizeof(Mask) == 1)
+            return _mm_set1_epi8((char) value);
+        else
+            return _mm_set1_epi16((short) value);
+    }
+
+    /**
+    * @fn template <typename Mask> __m128i add(__m128i a, __m128i b)
+    * @brief Additionne les masques des deux registres.
+    */
+    template<typename Mask>
+    __m128i add(__m128i a, __m128i b) {
+        if constexpr (sizeof(Mask) == 1)
+            return _mm_add_epi8(a, b);
+        else
+            return _mm_add_epi16(a, b);
+    }
+
+    /**
+    * @fn template <typename Mask> __m128i subtract(__m128i a, __m128i b)
+    * @brief Soustrait les masques de b à ceux de a.
+    */
+    template<typename Mask>
+    __m128i subtract(__m128i a, __m128i b) {
+        if constexpr (sizeof(Mask) == 1)
+            return _mm_sub_epi8(a, b);
+        else
+            return _mm_sub_epi16(a, b);
+    }
+
+    /**
+    * @fn template <typename Mask> __m128i equal(__m128i a, __m128i b)
+    * @brief Obtient -1 pour chaque masque égal dans les deux registres, 0
+    *        sinon.
+    */
+    template<typename Mask>
+    __m128i equal(__m128i a, __m128i b) {
+        if constexpr (sizeof(Mask) == 1)
+            return _mm_cmpeq_epi8(a, b);
+        else
+            return _mm_cmpeq_epi16(a, b);
+    }
+
+    /**
+    * @fn template <typename Mask> __m128i lower(__m128i a, __m128i b)
+    * @brief Obtient -1 pour chaque masque de a inférieur à celui de b, 0
+    *        sinon.
+    */
+    template<typename Mask>
+    __m128i lower(__m128i a, __m128i b) {
+        if constexpr (sizeof(Mask) == 1)
+            return _mm_cmplt_epi8(a, b);
+        else
+            return _mm_cmplt_epi16(a, b);
+    }
+#endif
+}
+
+BitParallelEngine::BitParallelEngine(const std::string &filename, size_t distance)
+        : distance(std::max<size_t>(distance, 1)), alphabet(0),
+          byteBuckets(BYTE_LENGTH + 1), shortBuckets(SHORT_LENGTH + 1),
+          longBuckets(LONG_LENGTH + 1) {
+    std::vector<std::string> words(loadSortedWords(filename));
+
+    // Codes des caractères du dictionnaire, les autres partagent le dernier.
+    bool used[256] = {};
+    for (const std::string &word : words)
+        for (char c : word)
+            used[(unsigned char) c] = true;
+
+    for (size_t c = 0; c < 256; ++c)
+        if (used[c])
+            codes[c] = (uint8_t) alphabet++;
+
+    for (size_t c = 0; c < 256; ++c)
+        if (!used[c])
+            codes[c] = (uint8_t) alphabet;
+
+    // Mots de chaque longueur
+    std::vector<std::vector<std::string>> lengths(LONG_LENGTH + 1);
+
+    for (std::string &word : words) {
+        if (word.length() <= LONG_LENGTH)
+            lengths[word.length()].push_back(std::move(word));
+        else
+            longWords.push_back(std::move(word));
+    }
+
+    for (size_t length = 1; length <= LONG_LENGTH; ++length) {
+        if (length <= BYTE_LENGTH)
+            fill(byteBuckets[length], length, lengths[length]);
+        else if (length <= SHORT_LENGTH)
+            fill(shortBuckets[length], length, lengths[length]);
+        else
+            fill(longBuckets[length], length, lengths[length]);
+    }
+}
+
+void BitParallelEngine::suggest(const std::string &word,
+                                std::vector<Correction> &corrections) {
+    if (word.empty())
+        return;
+
+    const size_t LENGTH = word.length();
+    const size_t FIRST = corrections.size();
+
+    this->word = word;
+    text.resize(LENGTH);
+
+    for (size_t i = 0; i < LENGTH; ++i)
+        text[i] = codes[(unsigned char) word[i]];
+
+    // Longueurs des mots à distance maximale au plus
+    const size_t LOW = LENGTH > distance ? LENGTH - distance : 1;
+    const size_t HIGH = LENGTH + distance;
+
+    for (size_t length = LOW; length <= HIGH; ++length) {
+        if (length <= BYTE_LENGTH)
+            scanPacked(byteBuckets[length], length, corrections);
+        else if (length <= SHORT_LENGTH)
+            scanPacked(shortBuckets[length], length, corrections);
+        else if (length <= LONG_LENGTH)
+            scan(longBuckets[length], length, corrections);
+    }
+
+    for (const std::string &candidate : longWords)
+        if (candidate.length() >= LOW && candidate.length() <= HIGH)
+            check(candidate.data(), candidate.length(), corrections);
+
+    std::sort(corrections.begin() + FIRST, corrections.end());
+}
+
+size_t BitParallelEngine::getDistance() const {
+    return distance;
+}
+
+size_t BitParallelEngine::countWords() const {
+    size_t count = longWords.size();
+
+    for (const Bucket<uint8_t> &bucket : byteBuckets)
+        count += bucket.count;
+
+    for (const Bucket<uint16_t> &bucket : shortBuckets)
+        count += bucket.count;
+
+    for (const Bucket<uint64_t> &bucket : longBuckets)
+        count += bucket.count;
+
+    return count;
+}
+
+size_t BitParallelEngine::memoryUsage() const {
+    size_t bytes = 0;
+
+    for (const Bucket<uint8_t> &bucket : byteBuckets)
+        bytes += bucket.letters.capacity() + bucket.masks.capacity();
+
+    for (const Bucket<uint16_t> &bucket : shortBuckets)
+        bytes += bucket.letters.capacity()
+                 + bucket.masks.capacity() * sizeof(uint16_t);
+
+    for (const Bucket<uint64_t> &bucket : longBuckets)
+        bytes += bucket.letters.capacity()
+                 + bucket.masks.capacity() * sizeof(uint64_t);
+
+    for (const std::string &candidate : longWords)
+        bytes += candidate.capacity();
+
+    return bytes;
+}
+
+template<typename Mask>
+void BitParallelEngine::fill(Bucket<Mask> &bucket, size_t length,
+                             const std::vector<std::string> &words) {
+    bucket.count = words.size();
+    bucket.stride = (words.size() + LANES - 1) / LANES * LANES;
+    bucket.masks.assign((alphabet + 1) * bucket.stride, 0);
+    bucket.letters.reserve(words.size() * length);
+
+    for (size_t w = 0; w < words.size(); ++w) {
+        bucket.letters += words[w];
+
+        for (size_t i = 0; i < length; ++i)
+            bucket.masks[codes[(unsigned char) words[w][i]] * bucket.stride + w]
+                    |= (Mask) (Mask(1) << i);
+    }
+}
+
+template<typename Mask>
+void BitParallelEngine::scan(const Bucket<Mask> &bucket, size_t length,
+                             std::vector<Correction> &corrections) {
+    const Mask TOP = (Mask) (Mask(1) << (length - 1));
+
+    for (size_t w = 0; w < bucket.count; ++w) {
+        // Colonne de la matrice des distances entre le motif et le préfixe
+        // vide du mot : +1 à chaque ligne.
+        Mask vp = (Mask) ~Mask(0);
+        Mask vn = 0;
+        Mask d0 = 0;
+        Mask previous = 0;
+        size_t score = length;
+
+        for (uint8_t code : text) {
+            const Mask PM = bucket.masks[code * bucket.stride + w];
+
+            // Inversion de deux lettres voisines (Hyyrö)
+            const Mask TR = (Mask) ((Mask) ((Mask) (~d0 & PM) << 1) & previous);
+            d0 = (Mask) (((Mask) ((Mask) (PM & vp) + vp) ^ vp) | PM | vn | TR);
+
+            Mask hp = (Mask) (vn | (Mask) ~(d0 | vp));
+            Mask hn = (Mask) (d0 & vp);
+
+            score += (hp & TOP) != 0;
+            score -= (hn & TOP) != 0;
+
+            hp = (Mask) ((Mask) (hp << 1) | 1);
+            hn = (Mask) (hn << 1);
+            vp = (Mask) (hn | (Mask) ~(d0 | hp));
+            vn = (Mask) (hp & d0);
+            previous = PM;
+        }
+
+        if (score <= distance)
+            check(bucket.letters.data() + w * length, length, corrections);
+    }
+}
+
+template<typename Mask>
+void BitParallelEngine::scanPacked(const Bucket<Mask> &bucket, size_t length,
+                                   std::vector<Correction> &corrections) {
+#ifdef __SSE2__
+    // Les distances ne dépassent pas la somme des longueurs des deux mots, qui
+    // doit tenir dans un masque signé.
+    const size_t BOUND = length + text.size();
+
+    if (BOUND >= (size_t) 1 << (8 * sizeof(Mask) - 1)) {
+        scan(bucket, length, corrections);
+        return;
+    }
+
+    // SSE2 n'a pas de décalage d'octets : un décalage d'un bit à gauche est
+    // une addition du masque à lui-même et le bit de la dernière ligne est lu
+    // par comparaison.
+    const __m128i ALL = _mm_set1_epi8(-1);
+    const __m128i ONE = broadcast<Mask>(1);
+    const __m128i TOP = broadcast<Mask>(1 << (length - 1));
+    const __m128i LIMIT = broadcast<Mask>((int) std::min(distance, BOUND) + 1);
+
+    for (size_t block = 0; block < bucket.count; block += LANES / sizeof(Mask)) {
+        __m128i vp = ALL;
+        __m128i vn = _mm_setzero_si128();
+        __m128i d0 = _mm_setzero_si128();
+        __m128i previous = _mm_setzero_si128();
+        __m128i score = broadcast<Mask>((int) length);
+
+        for (uint8_t code : text) {
+            const __m128i PM = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                    bucket.masks.data() + code * bucket.stride + block));
+
+            // Inversion de deux lettres voisines (Hyyrö)
+            __m128i tr = _mm_andnot_si128(d0, PM);
+            tr = _mm_and_si128(add<Mask>(tr, tr), previous);
+
+            d0 = _mm_xor_si128(add<Mask>(_mm_and_si128(PM, vp), vp), vp);
+            d0 = _mm_or_si128(_mm_or_si128(d0, PM), _mm_or_si128(vn, tr));
+
+            __m128i hp = _mm_or_si128(vn, _mm_xor_si128(_mm_or_si128(d0, vp), ALL));
+            __m128i hn = _mm_and_si128(d0, vp);
+
+            // Les comparaisons valent -1 pour chaque dernier bit levé.
+            score = subtract<Mask>(score, equal<Mask>(_mm_and_si128(hp, TOP), TOP));
+            score = add<Mask>(score, equal<Mask>(_mm_and_si128(hn, TOP), TOP));
+
+            hp = _mm_or_si128(add<Mask>(hp, hp), ONE);
+            hn = add<Mask>(hn, hn);
+            vp = _mm_or_si128(hn, _mm_xor_si128(_mm_or_si128(d0, hp), ALL));
+            vn = _mm_and_si128(hp, d0);
+            previous = PM;
+        }
+
+        // sizeof(Mask) bits par mot dont la distance ne dépasse pas la limite
+        unsigned hits = (unsigned) _mm_movemask_epi8(lower<Mask>(score, LIMIT));
+
+        while (hits) {
+            const size_t LANE = __builtin_ctz(hits) / sizeof(Mask);
+            const size_t w = block + LANE;
+            hits &= ~(((1U << sizeof(Mask)) - 1) << (LANE * sizeof(Mask)));
+
+            if (w < bucket.count)
+                check(bucket.letters.data() + w * length, length, corrections);
+        }
+    }
+#else
+    scan(bucket, length, corrections);
+#endif
+}
+
+void BitParallelEngine::check(const char *candidate, size_t length,
+                              std::vector<Correction> &corrections) {
+    addCorrections(word, std::string(candidate, length), distance, corrections);
+}
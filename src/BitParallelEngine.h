@@ -0,0 +1,199 @@
+/**
+*  @file BitParallelEngine.h
+*  @brief Modélise un moteur de suggestions qui compare le mot à tous les
+*         mots du dictionnaire de longueur voisine, avec l'algorithme
+*         bit-parallèle de Myers étendu aux inversions par Hyyrö.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ISuggestionEngine.h"
+
+/**
+* Les mots du dictionnaire sont regroupés par longueur. Un mot de longueur n
+* sert de motif : une colonne de la matrice des distances tient dans n bits
+* et chaque lettre du mot mal orthographié la fait avancer en une dizaine
+* d'opérations logiques. Seuls les groupes dont la longueur diffère d'au plus
+* la distance maximale sont parcourus.
+*
+* Pour chaque groupe, le masque des positions de chaque caractère dans chaque
+* mot est rangé caractère par caractère : les masques d'un caractère pour des
+* mots consécutifs sont contigus. Avec SSE2, les mots d'au plus 8 lettres
+* sont ainsi comparés seize par seize et ceux d'au plus 16 lettres huit par
+* huit, une lettre du mot mal orthographié coûtant un seul chargement par
+* bloc.
+*
+* La distance calculée ignore que seules les lettres de 'a' à 'z' peuvent être
+* ajoutées ou remplacées ; elle ne dépasse donc jamais la distance de
+* EditDistance.h, qui est recalculée pour chaque mot retenu.
+*/
+class BitParallelEngine : public ISuggestionEngine {
+public:
+    /**
+    * @fn BitParallelEngine(const std::string& filename, size_t distance)
+    * @brief Constructeur du moteur avec le nom du fichier du dictionnaire et
+    *        la distance d'édition maximale des corrections. Les mots ajoutés
+    *        ou supprimés du dictionnaire par la suite ne sont pas pris en
+    *        compte.
+    *
+    * @param[in] filename      nom du fichier du dictionnaire
+    * @param[in] distance      distance d'édition maximale, au moins 1
+    */
+    BitParallelEngine(const std::string &filename, size_t distance);
+
+    /**
+    * @fn void suggest(const std::string& word,
+    *                  std::vector<Correction>& corrections)
+    * @brief Ajoute les corrections du mot jusqu'à la distance maximale, dans
+    *        l'ordre de Correction.
+    *
+    * @param[in] word           mot mal orthographié, nettoyé
+    * @param[out] corrections   tableau auquel ajouter les corrections
+    */
+    void suggest(const std::string &word, std::vector<Correction> &corrections);
+
+    /**
+    * @fn size_t getDistance() const
+    * @brief Obtient la distance d'édition maximale des corrections.
+    *
+    * @return distance maximale.
+    */
+    size_t getDistance() const;
+
+    /**
+    * @fn size_t countWords() const
+    * @brief Obtient le nombre de mots comparés par le moteur.
+    *
+    * @return nombre de mots.
+    */
+    size_t countWords() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les mots et leurs masques.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @var   template <typename Mask> struct Bucket
+    * @brief Mots du dictionnaire d'une même longueur.
+    */
+    template<typename Mask>
+    struct Bucket {
+        size_t count = 0;           // nombre de mots
+        size_t stride = 0;          // nombre de mots arrondi au bloc suivant
+        std::string letters;        // mots à la suite, sans séparateur
+        std::vector<Mask> masks;    // masks[code * stride + mot]
+    };
+
+    // Longueur maximale des mots comparés avec des masques de 8, 16 et 64
+    // bits
+    static const size_t BYTE_LENGTH = 8;
+    static const size_t SHORT_LENGTH = 16;
+    static const size_t LONG_LENGTH = 64;
+
+    /**
+    * @fn template <typename Mask>
+    *     void fill(Bucket<Mask>& bucket, size_t length,
+    *               const std::vector<std::string>& words)
+    * @brief Range les mots d'une même longueur et leurs masques.
+    */
+    template<typename Mask>
+    void fill(Bucket<Mask> &bucket, size_t length, const std::vector<std::string> &words);
+
+    /**
+    * @fn template <typename Mask>
+    *     void scan(const Bucket<Mask>& bucket, size_t length,
+    *               std::vector<Correction>& corrections)
+    * @brief Ajoute les corrections du mot courant parmi les mots d'un groupe.
+    */
+    template<typename Mask>
+    void scan(const Bucket<Mask> &bucket, size_t length,
+              std::vector<Correction> &corrections);
+
+    /**
+    * @fn template <typename Mask>
+    *     void scanPacked(const Bucket<Mask>& bucket, size_t length,
+    *                     std::vector<Correction>& corrections)
+    * @brief Ajoute les corrections du mot courant parmi les mots d'un groupe
+    *        à masques de 8 ou 16 bits, un registre SSE2 de mots à la fois.
+    */
+    template<typename Mask>
+    void scanPacked(const Bucket<Mask> &bucket, size_t length,
+                    std::vector<Correction> &corrections);
+
+    /**
+    * @fn void check(const char* candidate, size_t length,
+    *                std::vector<Correction>& corrections)
+    * @brief Ajoute les corrections du mot courant menant à un mot retenu.
+    */
+    void check(const char *candidate, size_t length,
+               std::vector<Correction> &corrections);
+
+    /**
+    * @var   size_t distance
+    * @brief Distance d'édition maximale des corrections.
+    */
+    size_t distance;
+
+    /**
+    * @var   uint8_t codes[256]
+    * @brief Code de chaque caractère dans les masques. Les caractères absents
+    *        du dictionnaire ont le code alphabet, dont les masques sont nuls.
+    */
+    uint8_t codes[256];
+
+    /**
+    * @var   size_t alphabet
+    * @brief Nombre de caractères différents des mots du dictionnaire.
+    */
+    size_t alphabet;
+
+    /**
+    * @var   std::vector<Bucket<uint8_t>> byteBuckets
+    * @brief Mots d'au plus 8 lettres, indicés par leur longueur.
+    */
+    std::vector<Bucket<uint8_t>> byteBuckets;
+
+    /**
+    * @var   std::vector<Bucket<uint16_t>> shortBuckets
+    * @brief Mots de 9 à 16 lettres, indicés par leur longueur.
+    */
+    std::vector<Bucket<uint16_t>> shortBuckets;
+
+    /**
+    * @var   std::vector<Bucket<uint64_t>> longBuckets
+    * @brief Mots de 17 à 64 lettres, indicés par leur longueur.
+    */
+    std::vector<Bucket<uint64_t>> longBuckets;
+
+    /**
+    * @var   std::vector<std::string> longWords
+    * @brief Mots de plus de 64 lettres, comparés sans masque.
+    */
+    std::vector<std::string> longWords;
+
+    /**
+    * @var   std::string word
+    * @brief Mot en cours de correction.
+    */
+    std::string word;
+
+    /**
+    * @var   std::vector<uint8_t> text
+    * @brief Codes des caractères du mot en cours de correction.
+    */
+    std::vector<uint8_t> text;
+};
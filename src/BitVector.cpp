@@ -0,0 +1,158 @@
+/**
+*  @file BitVector.cpp
+*  @brief Modélise un vecteur de bits statique avec les opérations rank et
+*         select en temps quasi constant.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include "BitVector.h"
+
+namespace {
+    /**
+    * @fn size_t selectInWord(uint64_t word, size_t index)
+    * @brief Obtient la position du bit à 1 de rang donné dans un mot.
+    */
+    size_t selectInWord(uint64_t word, size_t index) {
+        while (index--)
+            word &= word - 1;
+
+        return (size_t) __builtin_ctzll(word);
+    }
+}
+
+BitVector::BitVector() {
+    clear();
+}
+
+void BitVector::push_back(bool bit) {
+    if (bits % WORD_BITS == 0)
+        words.push_back(0);
+
+    if (bit)
+        words.back() |= uint64_t(1) << (bits % WORD_BITS);
+
+    ++bits;
+}
+
+void BitVector::build() {
+    words.shrink_to_fit();
+
+    // Un mot nul de plus termine chaque bloc et évite les tests de fin.
+    const size_t BLOCKS = words.size() / BLOCK_WORDS + 1;
+    words.resize(BLOCKS * BLOCK_WORDS, 0);
+
+    ranks.assign(BLOCKS + 1, 0);
+    zeros.clear();
+
+    size_t ones = 0;
+    size_t zeroCount = 0;
+
+    for (size_t block = 0; block < BLOCKS; ++block) {
+        ranks[block] = (uint32_t) ones;
+
+        for (size_t i = 0; i < BLOCK_WORDS; ++i) {
+            const size_t word = block * BLOCK_WORDS + i;
+            const size_t first = word * WORD_BITS;
+
+            // Seuls les bits du vecteur comptent parmi les bits à 0.
+            const size_t valid = first >= bits ? 0
+                                 : (bits - first < WORD_BITS ? bits - first : WORD_BITS);
+            const size_t wordOnes = (size_t) __builtin_popcountll(words[word]);
+            const size_t wordZeros = valid - wordOnes;
+
+            while (zeros.size() * SELECT_SAMPLE < zeroCount + wordZeros)
+                zeros.push_back((uint32_t) block);
+
+            ones += wordOnes;
+            zeroCount += wordZeros;
+        }
+    }
+
+    ranks[BLOCKS] = (uint32_t) ones;
+
+    words.shrink_to_fit();
+    ranks.shrink_to_fit();
+    zeros.shrink_to_fit();
+}
+
+void BitVector::clear() {
+    std::vector<uint64_t>().swap(words);
+    std::vector<uint32_t>().swap(ranks);
+    std::vector<uint32_t>().swap(zeros);
+    bits = 0;
+}
+
+size_t BitVector::rank1(size_t position) const {
+    const size_t word = position / WORD_BITS;
+    const size_t offset = position % WORD_BITS;
+    size_t rank = ranks[position / BLOCK_BITS];
+
+    for (size_t i = word - word % BLOCK_WORDS; i < word; ++i)
+        rank += (size_t) __builtin_popcountll(words[i]);
+
+    if (offset)
+        rank += (size_t) __builtin_popcountll(words[word] << (WORD_BITS - offset));
+
+    return rank;
+}
+
+size_t BitVector::select0(size_t index) const {
+    if (index / SELECT_SAMPLE >= zeros.size())
+        return bits;
+
+    // Bloc contenant le bit : à partir de l'échantillon, tant que le bloc
+    // suivant commence avant lui.
+    const size_t LAST = ranks.size() - 1;
+    size_t block = zeros[index / SELECT_SAMPLE];
+
+    while (block + 1 < LAST && (block + 1) * BLOCK_BITS - ranks[block + 1] <= index)
+        ++block;
+
+    if ((block + 1) * BLOCK_BITS - ranks[block + 1] <= index)
+        return bits;
+
+    index -= block * BLOCK_BITS - ranks[block];
+
+    for (size_t word = block * BLOCK_WORDS;; ++word) {
+        const uint64_t inverted = ~words[word];
+        const size_t count = (size_t) __builtin_popcountll(inverted);
+
+        if (index < count) {
+            const size_t position = word * WORD_BITS + selectInWord(inverted, index);
+            return position < bits ? position : bits;
+        }
+
+        index -= count;
+    }
+}
+
+size_t BitVector::countOnes(size_t position) const {
+    size_t word = position / WORD_BITS;
+    size_t offset = position % WORD_BITS;
+    size_t count = 0;
+
+    // Les bits au-delà du vecteur sont nuls, la boucle se termine.
+    while (true) {
+        const uint64_t rest = ~(words[word] >> offset);
+        const size_t run = rest ? (size_t) __builtin_ctzll(rest) : WORD_BITS;
+        if (run < WORD_BITS - offset)
+            return count + run;
+
+        count += WORD_BITS - offset;
+        offset = 0;
+        ++word;
+    }
+}
+
+size_t BitVector::size() const {
+    return bits;
+}
+
+size_t BitVector::memoryUsage() const {
+    return words.capacity() * sizeof(uint64_t)
+           + ranks.capacity() * sizeof(uint32_t)
+           + zeros.capacity() * sizeof(uint32_t);
+}
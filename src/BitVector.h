@@ -0,0 +1,141 @@
+/**
+*  @file BitVector.h
+*  @brief Modélise un vecteur de bits statique avec les opérations rank et
+*         select en temps quasi constant.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class BitVector {
+public:
+    /**
+    * @fn BitVector()
+    * @brief Constructeur d'un vecteur de bits vide.
+    */
+    BitVector();
+
+    /**
+    * @fn void push_back(bool bit)
+    * @brief Ajoute un bit à la fin du vecteur. Les index de rank et select
+    *        ne sont plus valides jusqu'au prochain appel à build().
+    *
+    * @param[in] bit     bit à ajouter
+    */
+    void push_back(bool bit);
+
+    /**
+    * @fn void build()
+    * @brief Construit les index de rank et select, une fois tous les bits
+    *        ajoutés.
+    */
+    void build();
+
+    /**
+    * @fn void clear()
+    * @brief Supprime tous les bits et les index.
+    */
+    void clear();
+
+    /**
+    * @fn bool operator[](size_t position) const
+    * @brief Obtient la valeur d'un bit.
+    *
+    * @param[in] position    position du bit
+    *
+    * @return valeur du bit.
+    */
+    bool operator[](size_t position) const {
+        return (words[position / WORD_BITS] >> (position % WORD_BITS)) & 1;
+    }
+
+    /**
+    * @fn size_t rank1(size_t position) const
+    * @brief Obtient le nombre de bits à 1 avant la position, exclue.
+    *
+    * @param[in] position    position dans le vecteur, au plus size()
+    *
+    * @return nombre de bits à 1 dans [0, position).
+    */
+    size_t rank1(size_t position) const;
+
+    /**
+    * @fn size_t select0(size_t index) const
+    * @brief Obtient la position du bit à 0 de rang donné.
+    *
+    * @param[in] index     rang du bit à 0, à partir de 0
+    *
+    * @return position du bit, size() s'il n'existe pas.
+    */
+    size_t select0(size_t index) const;
+
+    /**
+    * @fn size_t countOnes(size_t position) const
+    * @brief Obtient le nombre de bits à 1 consécutifs depuis la position.
+    *
+    * @param[in] position    position du premier bit
+    *
+    * @return longueur de la suite de bits à 1.
+    */
+    size_t countOnes(size_t position) const;
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de bits du vecteur.
+    *
+    * @return nombre de bits.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les bits et les index.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    // Nombre de bits d'un mot.
+    static constexpr size_t WORD_BITS = 64;
+
+    // Nombre de mots d'un bloc de l'index de rank.
+    static constexpr size_t BLOCK_WORDS = 4;
+
+    // Nombre de bits d'un bloc de l'index de rank.
+    static constexpr size_t BLOCK_BITS = BLOCK_WORDS * WORD_BITS;
+
+    // Intervalle entre deux bits à 0 échantillonnés pour select.
+    static constexpr size_t SELECT_SAMPLE = 256;
+
+    /**
+    * @var   std::vector<uint64_t> words
+    * @brief Bits du vecteur, du bit de poids faible au bit de poids fort.
+    */
+    std::vector<uint64_t> words;
+
+    /**
+    * @var   std::vector<uint32_t> ranks
+    * @brief Nombre de bits à 1 avant chaque bloc, plus le total à la fin.
+    */
+    std::vector<uint32_t> ranks;
+
+    /**
+    * @var   std::vector<uint32_t> zeros
+    * @brief Bloc contenant chaque SELECT_SAMPLE-ième bit à 0.
+    */
+    std::vector<uint32_t> zeros;
+
+    /**
+    * @var   size_t bits
+    * @brief Nombre de bits du vecteur.
+    */
+    size_t bits;
+};
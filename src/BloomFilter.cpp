@@ -0,0 +1,123 @@
+/**
+*  @file BloomFilter.cpp
+*  @brief Modélise un filtre de Bloom par blocs : un test d'appartenance
+*         approximatif, sans faux négatif, qui ne lit qu'une ligne de cache.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "BloomFilter.h"
+#include "Hash.h"
+
+// Nombre maximal de bits testés par mot
+#define MAX_HASHES 16
+
+// Nombre de bits de l'empreinte pour choisir un bit d'un bloc de 512
+#define BIT_INDEX_BITS 9
+
+namespace {
+    /**
+    * @fn size_t nextBit(uint64_t hash, uint64_t& bits, size_t i)
+    * @brief Obtient la position du i-ème bit d'un mot dans son bloc. Les
+    *        positions sont prises 9 bits à la fois dans l'empreinte du mot,
+    *        mélangée avec i toutes les 7 positions. Des positions
+    *        indépendantes évitent qu'un mot absent ne reproduise exactement
+    *        les bits d'un mot du bloc, comme le ferait un double hachage
+    *        dans un si petit bloc.
+    */
+    size_t nextBit(uint64_t hash, uint64_t &bits, size_t i) {
+        const size_t PER_HASH = 64 / BIT_INDEX_BITS;
+
+        // Les bits de poids fort ont choisi le bloc, ils sont mélangés
+        // avant de servir.
+        if (i % PER_HASH == 0)
+            bits = hashMix(hash + i);
+
+        const size_t bit = (size_t) (bits & ((1 << BIT_INDEX_BITS) - 1));
+        bits >>= BIT_INDEX_BITS;
+
+        return bit;
+    }
+}
+
+BloomFilter::BloomFilter() {
+    clear();
+}
+
+void BloomFilter::build(const std::vector<std::string> &words,
+                        double falsePositiveRate) {
+    clear();
+
+    // Taille optimale d'un filtre classique, -log2(p) / ln(2) bits par mot,
+    // augmentée de 10 % et d'un bit pour compenser l'inégale répartition des
+    // mots dans les blocs. -log2(p) bits sont testés par mot.
+    const double LN2 = std::log(2.0);
+    const double bitsPerWord = -std::log2(falsePositiveRate) / LN2 * 1.1 + 1;
+    const size_t BLOCK_BITS = BLOCK_WORDS * 64;
+    const size_t bits = (size_t) std::ceil(bitsPerWord * std::max<size_t>(words.size(), 1));
+
+    blocks.assign((bits + BLOCK_BITS - 1) / BLOCK_BITS, Block{});
+    hashes = std::min<size_t>(MAX_HASHES, std::max<long>(
+            1, std::lround(-std::log2(falsePositiveRate))));
+
+    for (const std::string &word : words) {
+        const uint64_t hash = hashWord(word.data(), word.length());
+        Block &block = blocks[hashRange(hash, blocks.size())];
+
+        uint64_t bits = 0;
+
+        for (size_t i = 0; i < hashes; ++i) {
+            const size_t bit = nextBit(hash, bits, i);
+            block.words[bit / 64] |= uint64_t(1) << (bit % 64);
+        }
+    }
+}
+
+void BloomFilter::clear() {
+    std::vector<Block>().swap(blocks);
+    hashes = 0;
+}
+
+bool BloomFilter::mayContain(const std::string &word) const {
+    return mayContain(hashWord(word.data(), word.length()));
+}
+
+bool BloomFilter::mayContain(uint64_t hash) const {
+    if (blocks.empty())
+        return false;
+
+    const Block &block = blocks[hashRange(hash, blocks.size())];
+
+    uint64_t bits = 0;
+
+    for (size_t i = 0; i < hashes; ++i) {
+        const size_t bit = nextBit(hash, bits, i);
+
+        if (!(block.words[bit / 64] & (uint64_t(1) << (bit % 64))))
+            return false;
+    }
+
+    return true;
+}
+
+void BloomFilter::prefetch(uint64_t hash) const {
+    if (!blocks.empty())
+        __builtin_prefetch(&blocks[hashRange(hash, blocks.size())]);
+}
+
+size_t BloomFilter::countHashes() const {
+    return hashes;
+}
+
+size_t BloomFilter::countBits() const {
+    return blocks.size() * BLOCK_WORDS * 64;
+}
+
+size_t BloomFilter::memoryUsage() const {
+    return blocks.capacity() * sizeof(Block);
+}
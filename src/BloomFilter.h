@@ -0,0 +1,125 @@
+/**
+*  @file BloomFilter.h
+*  @brief Modélise un filtre de Bloom par blocs : un test d'appartenance
+*         approximatif, sans faux négatif, qui ne lit qu'une ligne de cache.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+* Chaque mot choisit un bloc de 512 bits, aligné sur une ligne de cache, puis
+* k bits dans ce bloc. Un mot dont l'un des k bits est à 0 n'a jamais été
+* ajouté. Le taux de faux positifs est un peu plus élevé qu'avec des bits
+* répartis dans tout le filtre, ce que compensent quelques bits de plus par
+* mot.
+*/
+class BloomFilter {
+public:
+    /**
+    * @fn BloomFilter()
+    * @brief Constructeur d'un filtre vide, qui rejette tous les mots.
+    */
+    BloomFilter();
+
+    /**
+    * @fn void build(const std::vector<std::string>& words,
+    *                double falsePositiveRate)
+    * @brief Dimensionne le filtre pour le taux de faux positifs visé puis y
+    *        ajoute les mots, en remplaçant le contenu actuel.
+    *
+    * @param[in] words               mots à ajouter
+    * @param[in] falsePositiveRate   taux de faux positifs visé, dans ]0, 1[
+    */
+    void build(const std::vector<std::string> &words, double falsePositiveRate);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du filtre.
+    */
+    void clear();
+
+    /**
+    * @fn bool mayContain(const std::string& word) const
+    * @brief Indique si le mot a peut-être été ajouté au filtre.
+    *
+    * @param[in] word     mot à tester
+    *
+    * @return false si le mot n'a certainement pas été ajouté, true sinon.
+    */
+    bool mayContain(const std::string &word) const;
+
+    /**
+    * @fn bool mayContain(uint64_t hash) const
+    * @brief Indique si le mot d'empreinte donnée a peut-être été ajouté au
+    *        filtre.
+    *
+    * @param[in] hash     hashWord() du mot à tester
+    *
+    * @return false si le mot n'a certainement pas été ajouté, true sinon.
+    */
+    bool mayContain(uint64_t hash) const;
+
+    /**
+    * @fn void prefetch(uint64_t hash) const
+    * @brief Lance le chargement du bloc d'une empreinte, lu par mayContain().
+    *
+    * @param[in] hash     hashWord() du mot qui sera testé
+    */
+    void prefetch(uint64_t hash) const;
+
+    /**
+    * @fn size_t countHashes() const
+    * @brief Obtient le nombre de bits testés par mot.
+    *
+    * @return nombre de bits par mot.
+    */
+    size_t countHashes() const;
+
+    /**
+    * @fn size_t countBits() const
+    * @brief Obtient le nombre de bits du filtre.
+    *
+    * @return nombre de bits.
+    */
+    size_t countBits() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par le filtre.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    // Nombre de mots de 64 bits d'un bloc, une ligne de cache
+    static constexpr size_t BLOCK_WORDS = 8;
+
+    /**
+    * @var   struct Block
+    * @brief Bloc de bits, aligné sur une ligne de cache.
+    */
+    struct alignas(64) Block {
+        uint64_t words[BLOCK_WORDS];
+    };
+
+    /**
+    * @var   std::vector<Block> blocks
+    * @brief Blocs du filtre.
+    */
+    std::vector<Block> blocks;
+
+    /**
+    * @var   size_t hashes
+    * @brief Nombre de bits testés par mot.
+    */
+    size_t hashes;
+};
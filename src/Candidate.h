@@ -0,0 +1,365 @@
+/**
+*  @file Candidate.h
+*  @brief Modélise les candidats de correction d'un mot mal orthographié,
+*         décrits par une modification du mot et leur empreinte.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Hash.h"
+
+class CandidateGenerator;
+
+/**
+* @var   struct Candidate
+* @brief Mot obtenu par une modification d'un mot mal orthographié. Ses
+*        caractères ne sont copiés que par str(), une fois le candidat trouvé
+*        dans le dictionnaire.
+*/
+struct Candidate {
+    const std::string *word;    // mot mal orthographié
+    const CandidateGenerator *generator; // générateur du candidat
+    int type;                   // 1 lettre en trop, 2 manquante, 3 erronée, 4 inversée
+    size_t position;            // position de la modification dans le mot
+    char letter;                // lettre ajoutée ou remplacée, nulle sinon
+    uint64_t hash;              // hashWord() du candidat
+
+    /**
+    * @fn size_t length() const
+    * @brief Obtient la longueur du candidat.
+    *
+    * @return nombre de caractères.
+    */
+    size_t length() const {
+        return type == 1 ? word->length() - 1 : type == 2 ? word->length() + 1 : word->length();
+    }
+
+    /**
+    * @fn char at(size_t i) const
+    * @brief Obtient un caractère du candidat.
+    *
+    * @param[in] i     position du caractère, inférieure à length()
+    *
+    * @return caractère.
+    */
+    char at(size_t i) const {
+        if (i < position)
+            return (*word)[i];
+
+        switch (type) {
+            case 1:
+                return (*word)[i + 1];
+            case 2:
+                return i == position ? letter : (*word)[i - 1];
+            case 3:
+                return i == position ? letter : (*word)[i];
+            default:
+                return i == position ? (*word)[i + 1]
+                                     : i == position + 1 ? (*word)[i - 1] : (*word)[i];
+        }
+    }
+
+    /**
+    * @fn bool equals(const char* data, size_t size) const
+    * @brief Compare le candidat à des caractères : le préfixe et le suffixe
+    *        inchangés du mot sont comparés d'un bloc.
+    *
+    * @param[in] data      caractères à comparer
+    * @param[in] size      nombre de caractères
+    *
+    * @return true si le candidat est égal aux caractères, false sinon.
+    */
+    bool equals(const char *data, size_t size) const {
+        if (size != length())
+            return false;
+
+        // Partie modifiée du candidat : [position, position + CHANGED)
+        const size_t CHANGED = type == 1 ? 0 : type == 4 ? 2 : 1;
+
+        // Début du suffixe inchangé dans le mot
+        const size_t SUFFIX = type == 2 ? position : position + (type == 4 ? 2 : 1);
+
+        if (std::memcmp(data, word->data(), position) != 0)
+            return false;
+
+        for (size_t i = position; i < position + CHANGED; ++i)
+            if (data[i] != at(i))
+                return false;
+
+        return std::memcmp(data + position + CHANGED, word->data() + SUFFIX,
+                           word->length() - SUFFIX) == 0;
+    }
+
+    /**
+    * @fn void write(std::string& candidate) const
+    * @brief Ecris le candidat dans une chaîne, dont la mémoire est
+    *        réutilisée.
+    *
+    * @param[out] candidate    chaîne remplacée par le candidat
+    */
+    void write(std::string &candidate) const {
+        // Préfixe inchangé, partie modifiée puis suffixe inchangé du mot
+        const size_t CHANGED = type == 1 ? 0 : type == 4 ? 2 : 1;
+        const size_t SUFFIX = type == 2 ? position : position + (type == 4 ? 2 : 1);
+
+        candidate.assign(*word, 0, position);
+
+        for (size_t i = position; i < position + CHANGED; ++i)
+            candidate.push_back(at(i));
+
+        candidate.append(*word, SUFFIX, std::string::npos);
+    }
+
+    /**
+    * @fn std::string str() const
+    * @brief Construit le candidat.
+    *
+    * @return mot candidat.
+    */
+    std::string str() const {
+        std::string candidate;
+        candidate.reserve(length());
+        write(candidate);
+
+        return candidate;
+    }
+
+    /**
+    * @fn const std::string& text() const
+    * @brief Obtient le candidat dans la chaîne de son générateur, que les
+    *        candidats successifs d'une même position modifient sur place.
+    *        La chaîne change avec le prochain appel sur le générateur.
+    *
+    * @return mot candidat.
+    */
+    inline const std::string &text() const;
+};
+
+/**
+* Le hachage polynomial de Hash.h est calculé une fois pour chaque préfixe du
+* mot mal orthographié. Celui d'une partie du mot s'en déduit : le suffixe
+* [j, n) vaut P[n] - P[j] * B^(n - j), avec P[j] le hachage du préfixe de
+* longueur j et B la base. L'empreinte de chaque candidat est ainsi obtenue
+* en temps constant, sans construire le candidat.
+*/
+class CandidateGenerator {
+public:
+    // Nombre de lettres essayées à chaque position, de 'a' à 'z'
+    static const size_t LETTERS = 26;
+
+    /**
+    * @fn void prepare(const std::string& word)
+    * @brief Calcule les hachages des préfixes du mot. Le mot doit rester
+    *        inchangé tant que ses candidats sont utilisés.
+    *
+    * @param[in] word      mot mal orthographié
+    */
+    void prepare(const std::string &word) {
+        const size_t LENGTH = word.length();
+
+        this->word = &word;
+        bufferType = 0;
+        prefixes.resize(LENGTH + 1);
+        powers.resize(LENGTH + 2);
+
+        prefixes[0] = 0;
+        powers[0] = 1;
+
+        for (size_t i = 0; i < LENGTH; ++i)
+            prefixes[i + 1] = polynomialHash(word.data() + i, 1, prefixes[i]);
+
+        for (size_t i = 1; i < powers.size(); ++i)
+            powers[i] = powers[i - 1] * WORD_HASH_BASE;
+    }
+
+    /**
+    * @fn const std::string& text(const Candidate& candidate) const
+    * @brief Ecris un candidat du mot dans la chaîne du générateur. Pour un
+    *        candidat de même type et de même position que le précédent,
+    *        seule la lettre ajoutée ou remplacée est écrite.
+    *
+    * @param[in] candidate     candidat du mot préparé
+    *
+    * @return chaîne du générateur.
+    */
+    const std::string &text(const Candidate &candidate) const {
+        if (candidate.type != bufferType || candidate.position != bufferPosition) {
+            candidate.write(buffer);
+            bufferType = candidate.type;
+            bufferPosition = candidate.position;
+        } else if (candidate.letter) {
+            buffer[candidate.position] = candidate.letter;
+        }
+
+        return buffer;
+    }
+
+    /**
+    * @fn Candidate deletion(size_t position) const
+    * @brief Obtient le candidat sans la lettre à la position donnée.
+    */
+    Candidate deletion(size_t position) const {
+        const size_t LENGTH = word->length();
+        const uint64_t POLYNOMIAL = prefixes[position] * powers[LENGTH - 1 - position]
+                                    + suffix(position + 1);
+
+        return Candidate{word, this, 1, position, 0, hashWord(POLYNOMIAL, LENGTH - 1)};
+    }
+
+    /**
+    * @fn Candidate insertion(size_t position, char letter) const
+    * @brief Obtient le candidat avec une lettre ajoutée avant la position
+    *        donnée.
+    */
+    Candidate insertion(size_t position, char letter) const {
+        const size_t LENGTH = word->length();
+        const uint64_t POLYNOMIAL = prefixes[position] * powers[LENGTH - position + 1]
+                                    + code(letter) * powers[LENGTH - position]
+                                    + suffix(position);
+
+        return Candidate{word, this, 2, position, letter, hashWord(POLYNOMIAL, LENGTH + 1)};
+    }
+
+    /**
+    * @fn Candidate substitution(size_t position, char letter) const
+    * @brief Obtient le candidat dont la lettre à la position donnée est
+    *        remplacée.
+    */
+    Candidate substitution(size_t position, char letter) const {
+        const size_t LENGTH = word->length();
+        const uint64_t POLYNOMIAL = prefixes[LENGTH]
+                                    + (code(letter) - code((*word)[position]))
+                                      * powers[LENGTH - 1 - position];
+
+        return Candidate{word, this, 3, position, letter, hashWord(POLYNOMIAL, LENGTH)};
+    }
+
+    /**
+    * @fn void insertions(size_t position, Candidate* candidates) const
+    * @brief Obtient les LETTERS candidats avec une lettre ajoutée avant la
+    *        position donnée, par ordre de lettre. Leurs hachages
+    *        polynomiaux ne diffèrent que d'un multiple de la lettre : les
+    *        empreintes sont calculées ensemble, sans dépendance de l'une à
+    *        l'autre.
+    *
+    * @param[in] position      position de la lettre ajoutée
+    * @param[out] candidates   tableau de LETTERS candidats
+    */
+    void insertions(size_t position, Candidate *candidates) const {
+        const size_t LENGTH = word->length();
+        const uint64_t STEP = powers[LENGTH - position];
+        const uint64_t BASE = prefixes[position] * powers[LENGTH - position + 1]
+                              + suffix(position);
+
+        for (size_t i = 0; i < LETTERS; ++i) {
+            const char c = (char) ('a' + i);
+            candidates[i] = Candidate{word, this, 2, position, c,
+                                      hashWord(BASE + code(c) * STEP, LENGTH + 1)};
+        }
+    }
+
+    /**
+    * @fn void substitutions(size_t position, Candidate* candidates) const
+    * @brief Obtient les LETTERS candidats dont la lettre à la position donnée
+    *        est remplacée, par ordre de lettre, comme insertions().
+    *
+    * @param[in] position      position de la lettre remplacée
+    * @param[out] candidates   tableau de LETTERS candidats
+    */
+    void substitutions(size_t position, Candidate *candidates) const {
+        const size_t LENGTH = word->length();
+        const uint64_t STEP = powers[LENGTH - 1 - position];
+        const uint64_t BASE = prefixes[LENGTH] - code((*word)[position]) * STEP;
+
+        for (size_t i = 0; i < LETTERS; ++i) {
+            const char c = (char) ('a' + i);
+            candidates[i] = Candidate{word, this, 3, position, c,
+                                      hashWord(BASE + code(c) * STEP, LENGTH)};
+        }
+    }
+
+    /**
+    * @fn Candidate transposition(size_t position) const
+    * @brief Obtient le candidat dont les lettres à la position donnée et à
+    *        la suivante sont inversées.
+    */
+    Candidate transposition(size_t position) const {
+        const size_t LENGTH = word->length();
+        const uint64_t DIFFERENCE = code((*word)[position + 1]) - code((*word)[position]);
+        const uint64_t POLYNOMIAL = prefixes[LENGTH]
+                                    + DIFFERENCE * powers[LENGTH - 1 - position]
+                                    - DIFFERENCE * powers[LENGTH - 2 - position];
+
+        return Candidate{word, this, 4, position, 0, hashWord(POLYNOMIAL, LENGTH)};
+    }
+
+private:
+    /**
+    * @fn static uint64_t code(char c)
+    * @brief Obtient la valeur d'un caractère dans le hachage polynomial.
+    */
+    static uint64_t code(char c) {
+        return (unsigned char) c;
+    }
+
+    /**
+    * @fn uint64_t suffix(size_t position) const
+    * @brief Obtient le hachage polynomial du suffixe du mot débutant à la
+    *        position donnée.
+    */
+    uint64_t suffix(size_t position) const {
+        const size_t LENGTH = word->length();
+        return prefixes[LENGTH] - prefixes[position] * powers[LENGTH - position];
+    }
+
+    /**
+    * @var   const std::string* word
+    * @brief Mot mal orthographié.
+    */
+    const std::string *word = nullptr;
+
+    /**
+    * @var   std::vector<uint64_t> prefixes
+    * @brief Hachage polynomial de chaque préfixe du mot, prefixes[j] pour
+    *        celui de longueur j.
+    */
+    std::vector<uint64_t> prefixes;
+
+    /**
+    * @var   std::vector<uint64_t> powers
+    * @brief Puissances de la base du hachage, jusqu'à la longueur du mot
+    *        plus 1.
+    */
+    std::vector<uint64_t> powers;
+
+    /**
+    * @var   std::string buffer
+    * @brief Dernier candidat écrit par text().
+    */
+    mutable std::string buffer;
+
+    /**
+    * @var   int bufferType
+    * @brief Type du dernier candidat écrit, 0 si aucun.
+    */
+    mutable int bufferType = 0;
+
+    /**
+    * @var   size_t bufferPosition
+    * @brief Position du dernier candidat écrit.
+    */
+    mutable size_t bufferPosition = 0;
+};
+
+const std::string &Candidate::text() const {
+    return generator->text(*this);
+}
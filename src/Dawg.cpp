@@ -0,0 +1,203 @@
+/**
+*  @file Dawg.cpp
+*  @brief Modélise un automate fini acyclique minimal (Directed Acyclic Word
+*         Graph) reconnaissant un ensemble de mots.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <unordered_map>
+#include <utility>
+
+#include "Dawg.h"
+
+namespace {
+    /**
+    * @var   struct BuildState
+    * @brief Etat de l'automate pendant sa construction.
+    */
+    struct BuildState {
+        bool final;
+        std::vector<std::pair<char, uint32_t>> edges;
+    };
+
+    /**
+    * @fn std::string signature(const BuildState& state)
+    * @brief Obtient une clé identique pour deux états équivalents : même
+    *        caractère final et mêmes transitions vers des états déjà
+    *        minimisés.
+    */
+    std::string signature(const BuildState &state) {
+        std::string key(1, state.final ? '1' : '0');
+
+        for (const auto &edge : state.edges) {
+            key.push_back(edge.first);
+            key.append(reinterpret_cast<const char *>(&edge.second),
+                       sizeof(edge.second));
+        }
+
+        return key;
+    }
+}
+
+Dawg::Dawg() {
+    clear();
+}
+
+void Dawg::build(const std::vector<std::string> &words) {
+    clear();
+
+    // L'état 0 est la racine, jamais fusionnée.
+    std::vector<BuildState> states(1);
+    std::vector<uint32_t> freeStates;
+    std::unordered_map<std::string, uint32_t> registry;
+
+    // Transitions (parent, caractère, enfant) dont l'enfant n'est pas encore
+    // minimisé, de la racine jusqu'au dernier mot ajouté.
+    struct Unchecked {
+        uint32_t parent;
+        uint32_t child;
+    };
+    std::vector<Unchecked> unchecked;
+
+    // Fusionne les états non minimisés au-delà de la profondeur donnée.
+    auto minimize = [&](size_t depth) {
+        while (unchecked.size() > depth) {
+            const Unchecked last = unchecked.back();
+            unchecked.pop_back();
+
+            auto inserted = registry.emplace(signature(states[last.child]),
+                                             last.child);
+            if (inserted.second)
+                continue;
+
+            // Un état équivalent existe déjà : il remplace l'enfant.
+            states[last.parent].edges.back().second = inserted.first->second;
+            states[last.child].edges.clear();
+            freeStates.push_back(last.child);
+        }
+    };
+
+    const std::string *previous = nullptr;
+
+    for (const std::string &word : words) {
+        size_t common = 0;
+
+        if (previous)
+            while (common < word.length() && common < previous->length()
+                   && word[common] == (*previous)[common])
+                ++common;
+
+        minimize(common);
+
+        uint32_t state = unchecked.empty() ? 0 : unchecked.back().child;
+
+        for (size_t i = common; i < word.length(); ++i) {
+            uint32_t next;
+
+            if (freeStates.empty()) {
+                next = (uint32_t) states.size();
+                states.emplace_back();
+            } else {
+                next = freeStates.back();
+                freeStates.pop_back();
+            }
+
+            states[next].final = false;
+            states[state].edges.emplace_back(word[i], next);
+            unchecked.push_back(Unchecked{state, next});
+            state = next;
+        }
+
+        states[state].final = true;
+        previous = &word;
+    }
+
+    minimize(0);
+
+    // Numérotation compacte des états atteignables, dans l'ordre de leur
+    // découverte depuis la racine.
+    const uint32_t UNNUMBERED = UINT32_MAX;
+    std::vector<uint32_t> numbers(states.size(), UNNUMBERED);
+    std::vector<uint32_t> order(1, 0);
+    numbers[0] = 0;
+
+    for (size_t i = 0; i < order.size(); ++i)
+        for (const auto &edge : states[order[i]].edges)
+            if (numbers[edge.second] == UNNUMBERED) {
+                numbers[edge.second] = (uint32_t) order.size();
+                order.push_back(edge.second);
+            }
+
+    offsets.clear();
+    finals.clear();
+    offsets.reserve(order.size() + 1);
+    finals.reserve(order.size());
+
+    for (uint32_t state : order) {
+        offsets.push_back((uint32_t) labels.size());
+        finals.push_back(states[state].final);
+
+        for (const auto &edge : states[state].edges) {
+            labels.push_back(edge.first);
+            targets.push_back(numbers[edge.second]);
+        }
+    }
+
+    offsets.push_back((uint32_t) labels.size());
+
+    labels.shrink_to_fit();
+    targets.shrink_to_fit();
+    keys = words.size();
+}
+
+void Dawg::clear() {
+    std::vector<uint32_t>(1, 0).swap(offsets);
+    std::vector<bool>().swap(finals);
+    std::vector<char>().swap(labels);
+    std::vector<uint32_t>().swap(targets);
+    keys = 0;
+}
+
+bool Dawg::contains(const std::string &word) const {
+    if (finals.empty())
+        return false;
+
+    uint32_t state = 0;
+
+    for (char c : word) {
+        uint32_t edge = offsets[state];
+        const uint32_t END = offsets[state + 1];
+
+        while (edge < END && labels[edge] != c)
+            ++edge;
+
+        if (edge == END)
+            return false;
+
+        state = targets[edge];
+    }
+
+    return finals[state];
+}
+
+size_t Dawg::countKeys() const {
+    return keys;
+}
+
+size_t Dawg::countStates() const {
+    return finals.size();
+}
+
+size_t Dawg::countEdges() const {
+    return labels.size();
+}
+
+size_t Dawg::memoryUsage() const {
+    return offsets.capacity() * sizeof(uint32_t)
+           + finals.capacity() / 8
+           + labels.capacity() * sizeof(char)
+           + targets.capacity() * sizeof(uint32_t);
+}
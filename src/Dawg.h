@@ -0,0 +1,178 @@
+/**
+*  @file Dawg.h
+*  @brief Modélise un automate fini acyclique minimal (Directed Acyclic Word
+*         Graph) reconnaissant un ensemble de mots.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Dawg {
+public:
+    /**
+    * @fn Dawg()
+    * @brief Constructeur d'un automate vide.
+    */
+    Dawg();
+
+    /**
+    * @fn void build(const std::vector<std::string>& words)
+    * @brief Construit l'automate minimal des mots, en remplaçant le contenu
+    *        actuel. Les états équivalents sont fusionnés au fur et à mesure
+    *        de l'ajout des mots (algorithme de Daciuk et al.).
+    *
+    * @param[in] words     mots triés, sans doublon ni mot vide
+    */
+    void build(const std::vector<std::string> &words);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu de l'automate.
+    */
+    void clear();
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est reconnu par l'automate.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est reconnu, false sinon.
+    */
+    bool contains(const std::string &word) const;
+
+    /**
+    * @fn size_t countKeys() const
+    * @brief Obtient le nombre de mots reconnus par l'automate.
+    *
+    * @return nombre de mots reconnus.
+    */
+    size_t countKeys() const;
+
+    /**
+    * @fn size_t countStates() const
+    * @brief Obtient le nombre d'états de l'automate.
+    *
+    * @return nombre d'états.
+    */
+    size_t countStates() const;
+
+    /**
+    * @fn size_t countEdges() const
+    * @brief Obtient le nombre de transitions de l'automate.
+    *
+    * @return nombre de transitions.
+    */
+    size_t countEdges() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les tableaux de l'automate.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn bool isFinal(uint32_t state) const
+    * @brief Indique si l'état termine un mot. La racine est l'état 0 et
+    *        n'existe que si l'automate n'est pas vide.
+    *
+    * @param[in] state    état de l'automate
+    *
+    * @return true si l'état est final, false sinon.
+    */
+    bool isFinal(uint32_t state) const {
+        return finals[state];
+    }
+
+    /**
+    * @fn uint32_t firstEdge(uint32_t state) const
+    * @brief Obtient la première transition de l'état. Les transitions de
+    *        l'état sont dans [firstEdge(state), endEdge(state)), triées par
+    *        caractère.
+    *
+    * @param[in] state    état de l'automate
+    *
+    * @return numéro de la première transition.
+    */
+    uint32_t firstEdge(uint32_t state) const {
+        return offsets[state];
+    }
+
+    /**
+    * @fn uint32_t endEdge(uint32_t state) const
+    * @brief Obtient la transition qui suit la dernière transition de l'état.
+    *
+    * @param[in] state    état de l'automate
+    *
+    * @return numéro de la transition suivant la dernière.
+    */
+    uint32_t endEdge(uint32_t state) const {
+        return offsets[state + 1];
+    }
+
+    /**
+    * @fn char getLabel(uint32_t edge) const
+    * @brief Obtient le caractère d'une transition.
+    *
+    * @param[in] edge     numéro de la transition
+    *
+    * @return caractère de la transition.
+    */
+    char getLabel(uint32_t edge) const {
+        return labels[edge];
+    }
+
+    /**
+    * @fn uint32_t getTarget(uint32_t edge) const
+    * @brief Obtient l'état d'arrivée d'une transition.
+    *
+    * @param[in] edge     numéro de la transition
+    *
+    * @return état d'arrivée.
+    */
+    uint32_t getTarget(uint32_t edge) const {
+        return targets[edge];
+    }
+
+private:
+    /**
+    * @var   std::vector<uint32_t> offsets
+    * @brief Position de la première transition de chaque état dans labels et
+    *        targets. Les transitions de l'état s sont dans
+    *        [offsets[s], offsets[s + 1]), triées par caractère.
+    */
+    std::vector<uint32_t> offsets;
+
+    /**
+    * @var   std::vector<bool> finals
+    * @brief Indique pour chaque état s'il termine un mot.
+    */
+    std::vector<bool> finals;
+
+    /**
+    * @var   std::vector<char> labels
+    * @brief Caractère de chaque transition.
+    */
+    std::vector<char> labels;
+
+    /**
+    * @var   std::vector<uint32_t> targets
+    * @brief Etat d'arrivée de chaque transition.
+    */
+    std::vector<uint32_t> targets;
+
+    /**
+    * @var   size_t keys
+    * @brief Nombre de mots reconnus.
+    */
+    size_t keys;
+};
@@ -0,0 +1,61 @@
+/**
+*  @file DictionaryArt.cpp
+*  @brief Modélise un dictionnaire avec un arbre radix adaptatif.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <fstream>
+
+#include "DictionaryArt.h"
+#include "Tools.h"
+
+DictionaryArt::DictionaryArt(const std::string &filename) : IDictionary(filename) {
+    std::string line;
+    std::ifstream stream(filename);
+
+    // Création du dictionnaire.
+    while (std::getline(stream, line))
+        add(strSanitize(line));
+
+    stream.close();
+}
+
+DictionaryArt::~DictionaryArt() {
+    clear();
+}
+
+void DictionaryArt::add(const std::string &word) {
+    if (!word.empty())
+        tree.insert(word);
+}
+
+void DictionaryArt::clear() {
+    tree.clear();
+}
+
+bool DictionaryArt::empty() const {
+    return tree.size() == 0;
+}
+
+size_t DictionaryArt::remove(const std::string &word) {
+    return tree.remove(word) ? 1 : 0;
+}
+
+bool DictionaryArt::contains(const std::string &str) {
+    return tree.contains(str);
+}
+
+size_t DictionaryArt::size() const {
+    return tree.size();
+}
+
+size_t DictionaryArt::memoryUsage() const {
+    return tree.memoryUsage();
+}
+
+const AdaptiveRadixTree &DictionaryArt::getTree() const {
+    return tree;
+}
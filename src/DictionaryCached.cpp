@@ -0,0 +1,116 @@
+/**
+*  @file DictionaryCached.cpp
+*  @brief Modélise un dictionnaire en lecture seule dont l'image binaire est
+*         compilée une fois puis réutilisée tant que le fichier texte ne
+*         change pas.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+#include "DictionaryCached.h"
+#include "DictionaryImage.h"
+#include "DictionaryTree.h"
+
+// Extension des images en cache.
+#define IMAGE_EXTENSION ".bin"
+
+// Dossier des images dans le cache de l'utilisateur.
+#define CACHE_NAME "SpellChecker"
+
+DictionaryCached::DictionaryCached(const std::string &source,
+                                   const std::string &cacheDirectory)
+        : DictionaryMapped(compile(source, cacheDirectory)) {}
+
+std::string DictionaryCached::userCacheDirectory() {
+    const char *xdg = std::getenv("XDG_CACHE_HOME");
+    const char *home = std::getenv("HOME");
+
+    std::filesystem::path directory;
+    if (xdg && xdg[0] == '/')
+        directory = std::filesystem::path(xdg) / CACHE_NAME;
+    else if (home && home[0] != '\0')
+        directory = std::filesystem::path(home) / ".cache" / CACHE_NAME;
+    else
+        return "";
+
+    // Seul le dossier des images est réservé à l'utilisateur, ses parents
+    // sont créés avec les droits habituels.
+    std::error_code error;
+    std::filesystem::create_directories(directory.parent_path(), error);
+    ::mkdir(directory.c_str(), 0700);
+
+    // Un dossier d'un autre utilisateur, ou un lien, n'est pas utilisé.
+    struct stat status;
+    if (::lstat(directory.c_str(), &status) != 0 || !S_ISDIR(status.st_mode)
+        || status.st_uid != getuid() || (status.st_mode & 0077) != 0)
+        return "";
+
+    return directory.string();
+}
+
+std::string DictionaryCached::cacheFilename(const std::string &source,
+                                            const std::string &cacheDirectory) {
+    const std::string directory = cacheDirectory.empty() ? userCacheDirectory()
+                                                         : cacheDirectory;
+    if (directory.empty())
+        return "";
+
+    // Le chemin absolu distingue deux dictionnaires de même nom.
+    std::error_code error;
+    const std::filesystem::path path(source);
+    const std::string absolute = std::filesystem::absolute(path, error).string();
+
+    char hash[17];
+    std::snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)
+            DictionaryImage::checksum(absolute.data(), absolute.size()));
+
+    const std::string name = path.filename().string() + "-" + hash + IMAGE_EXTENSION;
+    return (std::filesystem::path(directory) / name).string();
+}
+
+std::string DictionaryCached::compile(const std::string &source,
+                                      const std::string &cacheDirectory) {
+    const std::string image = cacheFilename(source, cacheDirectory);
+    if (image.empty())
+        return "";
+
+    // Une image à jour est réutilisée sans relire son contenu : l'en-tête
+    // suffit, la somme de contrôle a été vérifiée à l'écriture.
+    DictionaryImage::Header header;
+    if (DictionaryImage::readHeader(image, header)
+        && DictionaryImage::isCompiledFrom(header, source))
+        return image;
+
+    std::error_code error;
+    if (!std::filesystem::exists(source, error))
+        return "";
+
+    // mkstemp crée un fichier qui n'existait pas, sans suivre de lien et
+    // lisible du seul utilisateur : l'image y est écrite puis vérifiée
+    // avant d'être renommée, un autre processus ne voit donc jamais
+    // d'image incomplète.
+    std::string partial = image + ".XXXXXX";
+    const int fd = mkstemp(&partial[0]);
+    if (fd < 0)
+        return "";
+
+    ::close(fd);
+
+    DictionaryFlatTree tree(source);
+
+    if (tree.save(partial) && DictionaryMapped(partial, true).isOpen()
+        && std::rename(partial.c_str(), image.c_str()) == 0)
+        return image;
+
+    std::remove(partial.c_str());
+    return "";
+}
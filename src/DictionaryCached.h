@@ -0,0 +1,79 @@
+/**
+*  @file DictionaryCached.h
+*  @brief Modélise un dictionnaire en lecture seule dont l'image binaire est
+*         compilée une fois puis réutilisée tant que le fichier texte ne
+*         change pas.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+
+#include "DictionaryMapped.h"
+
+class DictionaryCached : public DictionaryMapped {
+public:
+    /**
+    * @fn DictionaryCached(const std::string& source,
+    *                      const std::string& cacheDirectory = "")
+    * @brief Constructeur d'un dictionnaire avec le nom d'un fichier texte.
+    *        L'image en cache est projetée si elle correspond au fichier,
+    *        sinon elle est compilée et écrite avant d'être projetée.
+    *
+    * @param[in] source           nom du fichier texte du dictionnaire
+    * @param[in] cacheDirectory   dossier des images, vide pour le cache de
+    *                             l'utilisateur
+    */
+    DictionaryCached(const std::string &source,
+                     const std::string &cacheDirectory = "");
+
+    /**
+    * @fn static std::string userCacheDirectory()
+    * @brief Obtient le dossier des images dans le cache de l'utilisateur,
+    *        $XDG_CACHE_HOME/SpellChecker ou ~/.cache/SpellChecker, créé avec
+    *        les droits 0700 s'il n'existe pas.
+    *
+    * @return nom du dossier, vide s'il n'appartient pas à l'utilisateur, est
+    *         accessible aux autres ou n'a pas pu être créé.
+    */
+    static std::string userCacheDirectory();
+
+    /**
+    * @fn static std::string cacheFilename(const std::string& source,
+    *                                      const std::string& cacheDirectory)
+    * @brief Obtient le nom de l'image en cache d'un fichier texte.
+    *
+    * @param[in] source           nom du fichier texte du dictionnaire
+    * @param[in] cacheDirectory   dossier des images, vide pour le cache de
+    *                             l'utilisateur
+    *
+    * @return nom de l'image, vide si le cache de l'utilisateur n'est pas
+    *         utilisable.
+    */
+    static std::string cacheFilename(const std::string &source,
+                                     const std::string &cacheDirectory);
+
+    /**
+    * @fn static std::string compile(const std::string& source,
+    *                                const std::string& cacheDirectory = "")
+    * @brief S'assure qu'une image à jour du fichier texte existe. Une image
+    *        existante est réutilisée si son en-tête note la taille et la date
+    *        du fichier texte ; son contenu n'est pas relu. Sinon, l'image est
+    *        écrite dans un fichier créé par mkstemp, sa somme de contrôle est
+    *        vérifiée, puis elle est renommée : un autre processus ne voit
+    *        donc jamais d'image incomplète. Le dossier doit n'être accessible
+    *        en écriture qu'à l'utilisateur, comme son cache.
+    *
+    * @param[in] source           nom du fichier texte du dictionnaire
+    * @param[in] cacheDirectory   dossier des images, vide pour le cache de
+    *                             l'utilisateur
+    *
+    * @return nom de l'image à jour, vide si aucune n'a pu être écrite.
+    */
+    static std::string compile(const std::string &source,
+                               const std::string &cacheDirectory = "");
+};
@@ -0,0 +1,76 @@
+/**
+*  @file DictionaryDawg.cpp
+*  @brief Modélise un dictionnaire avec un automate fini acyclique minimal.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <vector>
+
+#include "DictionaryDawg.h"
+#include "Tools.h"
+
+DictionaryDawg::DictionaryDawg(const std::string &filename) : IDictionary(filename) {
+    // L'automate se construit à partir des mots triés et sans doublon.
+    std::vector<std::string> words(loadSortedWords(filename));
+
+    dawg.build(words);
+}
+
+DictionaryDawg::~DictionaryDawg() {
+    clear();
+}
+
+void DictionaryDawg::add(const std::string &word) {
+    if (word.empty())
+        return;
+
+    if (dawg.contains(word))
+        removed.erase(word);
+    else
+        added.insert(word);
+}
+
+void DictionaryDawg::clear() {
+    dawg.clear();
+    added.clear();
+    removed.clear();
+}
+
+bool DictionaryDawg::empty() const {
+    return size() == 0;
+}
+
+size_t DictionaryDawg::remove(const std::string &word) {
+    if (added.erase(word))
+        return 1;
+
+    if (dawg.contains(word) && removed.insert(word).second)
+        return 1;
+
+    return 0;
+}
+
+bool DictionaryDawg::contains(const std::string &str) {
+    if (str.empty())
+        return false;
+
+    if (dawg.contains(str))
+        return removed.empty() || removed.find(str) == removed.end();
+
+    return !added.empty() && added.find(str) != added.end();
+}
+
+size_t DictionaryDawg::size() const {
+    return dawg.countKeys() - removed.size() + added.size();
+}
+
+size_t DictionaryDawg::memoryUsage() const {
+    return dawg.memoryUsage() + ::memoryUsage(added) + ::memoryUsage(removed);
+}
+
+const Dawg &DictionaryDawg::getDawg() const {
+    return dawg;
+}
@@ -0,0 +1,123 @@
+/**
+*  @file DictionaryDawg.h
+*  @brief Modélise un dictionnaire avec un automate fini acyclique minimal.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_set>
+
+#include "Dawg.h"
+#include "IDictionary.h"
+
+class DictionaryDawg : public IDictionary {
+public:
+    /**
+    * @fn DictionaryDawg(const std::string& filename)
+    * @brief Constructeur d'un dictionnaire avec le nom d'un fichier à
+    *        importer. Les mots sont triés puis compilés en automate.
+    *
+    * @param[in] filename      nom d'un fichier à importer
+    */
+    DictionaryDawg(const std::string &filename);
+
+    /**
+    * @fn ~DictionaryDawg()
+    * @brief Destructeur d'un dictionnaire, suppression du contenu du
+    *        dictionnaire.
+    */
+    ~DictionaryDawg();
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Ajoute un mot au dictionnaire, si il n'y est pas présent.
+    *        L'automate n'est pas modifié, le mot est gardé à part.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du dictionnaire.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Supprime le mot du dictionnaire. Un mot de l'automate est
+    *        seulement marqué comme supprimé.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return nombre de mots du dictionnaire supprimés.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire utilisée par l'automate et par les mots
+    *        ajoutés ou supprimés après sa construction.
+    *
+    * @return nombre d'octets utilisés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn const Dawg& getDawg() const
+    * @brief Obtient l'automate du dictionnaire.
+    *
+    * @return automate du dictionnaire.
+    */
+    const Dawg &getDawg() const;
+
+private:
+    /**
+    * @var   Dawg dawg
+    * @brief Automate minimal des mots du fichier.
+    */
+    Dawg dawg;
+
+    /**
+    * @var   std::unordered_set<std::string> added
+    * @brief Mots ajoutés après la construction de l'automate.
+    */
+    std::unordered_set<std::string> added;
+
+    /**
+    * @var   std::unordered_set<std::string> removed
+    * @brief Mots de l'automate supprimés après sa construction.
+    */
+    std::unordered_set<std::string> removed;
+};
@@ -0,0 +1,46 @@
+/**
+*  @file DictionaryEmbedded.cpp
+*  @brief Modélise un dictionnaire en lecture seule intégré à l'exécutable
+*         lors de sa compilation (option EMBEDDED_DICTIONARY de CMake).
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include "DictionaryEmbedded.h"
+
+// Données produites par EmbedDictionary
+extern const char embeddedDictionarySource[];
+extern const size_t embeddedDictionarySize;
+extern const unsigned char embeddedDictionaryImage[];
+
+DictionaryEmbedded::DictionaryEmbedded() : IDictionary(embeddedDictionarySource) {
+    image.open(embeddedDictionaryImage, embeddedDictionarySize);
+}
+
+void DictionaryEmbedded::add(const std::string &) {}
+
+void DictionaryEmbedded::clear() {
+    image.close();
+}
+
+bool DictionaryEmbedded::empty() const {
+    return image.countKeys() == 0;
+}
+
+size_t DictionaryEmbedded::remove(const std::string &) {
+    return 0;
+}
+
+bool DictionaryEmbedded::contains(const std::string &str) {
+    return image.contains(str);
+}
+
+size_t DictionaryEmbedded::size() const {
+    return image.countKeys();
+}
+
+size_t DictionaryEmbedded::memoryUsage() const {
+    return image.size();
+}
@@ -0,0 +1,93 @@
+/**
+*  @file DictionaryEmbedded.h
+*  @brief Modélise un dictionnaire en lecture seule intégré à l'exécutable
+*         lors de sa compilation (option EMBEDDED_DICTIONARY de CMake).
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+
+#include "DictionaryImage.h"
+#include "IDictionary.h"
+
+class DictionaryEmbedded : public IDictionary {
+public:
+    /**
+    * @fn DictionaryEmbedded()
+    * @brief Constructeur du dictionnaire intégré. L'image binaire est
+    *        interrogée directement dans les données en lecture seule de
+    *        l'exécutable : aucune lecture de fichier ni construction.
+    */
+    DictionaryEmbedded();
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Sans effet, le dictionnaire est en lecture seule.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Oublie l'image intégrée, le dictionnaire devient vide.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Sans effet, le dictionnaire est en lecture seule.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return 0, aucun mot n'est supprimé.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la taille de l'image intégrée. Ses pages font partie de
+    *        l'exécutable et sont partagées entre ses processus.
+    *
+    * @return nombre d'octets de l'image.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @var   DictionaryImage image
+    * @brief Image du dictionnaire dans les données de l'exécutable.
+    */
+    DictionaryImage image;
+};
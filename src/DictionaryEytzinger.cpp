@@ -0,0 +1,113 @@
+/**
+*  @file DictionaryEytzinger.cpp
+*  @brief Modélise un dictionnaire avec un tableau trié rangé dans l'ordre
+*         d'Eytzinger.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include "DictionaryEytzinger.h"
+#include "Tools.h"
+
+DictionaryEytzinger::DictionaryEytzinger(const std::string &filename)
+        : IDictionary(filename) {
+    // Le tableau se construit à partir des mots triés et sans doublon.
+    std::vector<std::string> words(loadSortedWords(filename));
+
+    array.build(words);
+}
+
+DictionaryEytzinger::~DictionaryEytzinger() {
+    clear();
+}
+
+void DictionaryEytzinger::add(const std::string &word) {
+    if (word.empty())
+        return;
+
+    if (array.contains(word))
+        removed.erase(word);
+    else
+        added.insert(word);
+}
+
+void DictionaryEytzinger::clear() {
+    array.clear();
+    added.clear();
+    removed.clear();
+}
+
+bool DictionaryEytzinger::empty() const {
+    return size() == 0;
+}
+
+size_t DictionaryEytzinger::remove(const std::string &word) {
+    if (added.erase(word))
+        return 1;
+
+    if (array.contains(word) && removed.insert(word).second)
+        return 1;
+
+    return 0;
+}
+
+bool DictionaryEytzinger::contains(const std::string &str) {
+    if (str.empty())
+        return false;
+
+    if (array.contains(str))
+        return removed.empty() || removed.find(str) == removed.end();
+
+    return !added.empty() && added.find(str) != added.end();
+}
+
+size_t DictionaryEytzinger::size() const {
+    return array.size() - removed.size() + added.size();
+}
+
+size_t DictionaryEytzinger::memoryUsage() const {
+    return array.memoryUsage() + ::memoryUsage(added) + ::memoryUsage(removed);
+}
+
+std::vector<std::string> DictionaryEytzinger::range(const std::string &first,
+                                                    const std::string &last) const {
+    std::vector<std::string> stored;
+
+    // Mots du tableau, en suivant l'ordre symétrique de l'arbre implicite
+    for (size_t position = array.lowerBound(first); position != 0;
+         position = array.next(position)) {
+        std::string word(array.word(position));
+
+        if (!last.empty() && word >= last)
+            break;
+
+        if (removed.empty() || removed.find(word) == removed.end())
+            stored.push_back(std::move(word));
+    }
+
+    if (added.empty())
+        return stored;
+
+    // Fusion avec les mots ajoutés, qui ne sont jamais dans le tableau
+    const auto BEGIN = added.lower_bound(first);
+    const auto END = last.empty() ? added.end() : added.lower_bound(last);
+
+    std::vector<std::string> words;
+    words.reserve(stored.size() + std::distance(BEGIN, END));
+    std::merge(stored.begin(), stored.end(), BEGIN, END, std::back_inserter(words));
+
+    return words;
+}
+
+std::vector<std::string> DictionaryEytzinger::words() const {
+    return range("", "");
+}
+
+const EytzingerArray &DictionaryEytzinger::getArray() const {
+    return array;
+}
@@ -0,0 +1,149 @@
+/**
+*  @file DictionaryEytzinger.h
+*  @brief Modélise un dictionnaire avec un tableau trié rangé dans l'ordre
+*         d'Eytzinger.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "EytzingerArray.h"
+#include "IDictionary.h"
+
+class DictionaryEytzinger : public IDictionary {
+public:
+    /**
+    * @fn DictionaryEytzinger(const std::string& filename)
+    * @brief Constructeur d'un dictionnaire avec le nom d'un fichier à
+    *        importer. Les mots sont triés puis rangés dans le tableau.
+    *
+    * @param[in] filename      nom d'un fichier à importer
+    */
+    DictionaryEytzinger(const std::string &filename);
+
+    /**
+    * @fn ~DictionaryEytzinger()
+    * @brief Destructeur d'un dictionnaire, suppression du contenu du
+    *        dictionnaire.
+    */
+    ~DictionaryEytzinger();
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Ajoute un mot au dictionnaire, si il n'y est pas présent.
+    *        Le tableau n'est pas modifié, le mot est gardé à part.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du dictionnaire.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Supprime le mot du dictionnaire. Un mot du tableau est
+    *        seulement marqué comme supprimé.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return nombre de mots du dictionnaire supprimés.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire utilisée par le tableau et par les mots
+    *        ajoutés ou supprimés après sa construction.
+    *
+    * @return nombre d'octets utilisés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn std::vector<std::string> range(const std::string& first,
+    *                                    const std::string& last) const
+    * @brief Obtient dans l'ordre alphabétique les mots du dictionnaire
+    *        compris entre deux bornes.
+    *
+    * @param[in] first     premier mot possible, inclus
+    * @param[in] last      borne supérieure, exclue ; vide pour aucune borne
+    *
+    * @return mots de l'intervalle, triés.
+    */
+    std::vector<std::string> range(const std::string &first,
+                                   const std::string &last) const;
+
+    /**
+    * @fn std::vector<std::string> words() const
+    * @brief Obtient tous les mots du dictionnaire dans l'ordre alphabétique.
+    *
+    * @return mots du dictionnaire, triés.
+    */
+    std::vector<std::string> words() const;
+
+    /**
+    * @fn const EytzingerArray& getArray() const
+    * @brief Obtient le tableau du dictionnaire.
+    *
+    * @return tableau du dictionnaire.
+    */
+    const EytzingerArray &getArray() const;
+
+private:
+    /**
+    * @var   EytzingerArray array
+    * @brief Tableau des mots du fichier.
+    */
+    EytzingerArray array;
+
+    /**
+    * @var   std::set<std::string> added
+    * @brief Mots ajoutés après la construction du tableau, triés pour être
+    *        fusionnés avec ceux du tableau.
+    */
+    std::set<std::string> added;
+
+    /**
+    * @var   std::unordered_set<std::string> removed
+    * @brief Mots du tableau supprimés après sa construction.
+    */
+    std::unordered_set<std::string> removed;
+};
@@ -0,0 +1,86 @@
+/**
+*  @file DictionaryHash.cpp
+*  @brief Modélise un dictionnaire avec une table de hachage à adressage
+*         ouvert.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "DictionaryHash.h"
+#include "Tools.h"
+
+DictionaryHash::DictionaryHash(const std::string &filename) : IDictionary(filename) {
+    std::string line;
+    std::ifstream stream(filename);
+
+    // Dimensionnement de la table, un mot par ligne au plus
+    set.reserve((size_t) std::count(std::istreambuf_iterator<char>(stream),
+                                    std::istreambuf_iterator<char>(), '\n') + 1);
+
+    stream.clear();
+    stream.seekg(0);
+
+    // Création du dictionnaire.
+    while (std::getline(stream, line))
+        add(strSanitize(line));
+
+    stream.close();
+}
+
+DictionaryHash::~DictionaryHash() {
+    clear();
+}
+
+void DictionaryHash::add(const std::string &word) {
+    if (!word.empty())
+        set.insert(word);
+}
+
+void DictionaryHash::clear() {
+    set.clear();
+}
+
+bool DictionaryHash::empty() const {
+    return set.size() == 0;
+}
+
+size_t DictionaryHash::remove(const std::string &word) {
+    return set.erase(word);
+}
+
+bool DictionaryHash::contains(const std::string &str) {
+    return set.contains(str);
+}
+
+bool DictionaryHash::containsCandidate(const Candidate &candidate) {
+    return set.contains(candidate.hash, [&candidate](const char *data, size_t length) {
+        return candidate.equals(data, length);
+    });
+}
+
+void DictionaryHash::containsCandidates(const Candidate *candidates, size_t count,
+                                        bool *found) {
+    for (size_t i = 0; i < count; ++i)
+        set.prefetch(candidates[i].hash);
+
+    for (size_t i = 0; i < count; ++i)
+        found[i] = DictionaryHash::containsCandidate(candidates[i]);
+}
+
+size_t DictionaryHash::size() const {
+    return set.size();
+}
+
+size_t DictionaryHash::memoryUsage() const {
+    return set.memoryUsage();
+}
+
+const FlatHashSet &DictionaryHash::getSet() const {
+    return set;
+}
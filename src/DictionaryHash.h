@@ -0,0 +1,137 @@
+/**
+*  @file DictionaryHash.h
+*  @brief Modélise un dictionnaire avec une table de hachage à adressage
+*         ouvert.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+
+#include "FlatHashSet.h"
+#include "IDictionary.h"
+
+class DictionaryHash : public IDictionary {
+public:
+    /**
+    * @fn DictionaryHash(const std::string& filename)
+    * @brief Constructeur d'un dictionnaire avec le nom d'un fichier à
+    *        importer. La table est dimensionnée d'après le nombre de lignes
+    *        du fichier avant l'ajout des mots.
+    *
+    * @param[in] filename      nom d'un fichier à importer
+    */
+    DictionaryHash(const std::string &filename);
+
+    /**
+    * @fn ~DictionaryHash()
+    * @brief Destructeur d'un dictionnaire, suppression du contenu du
+    *        dictionnaire.
+    */
+    ~DictionaryHash();
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Ajoute un mot au dictionnaire, si il n'y est pas présent.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du dictionnaire.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Supprime le mot du dictionnaire.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return nombre de mots du dictionnaire supprimés.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn bool containsCandidate(const Candidate& candidate)
+    * @brief Indique si un candidat de correction est contenu dans le
+    *        dictionnaire. Il est cherché par son empreinte et comparé aux
+    *        mots de la table sans être construit.
+    *
+    * @param[in] candidate     candidat à rechercher
+    *
+    * @return true si le candidat est contenu dans le dictionnaire, false sinon
+    */
+    bool containsCandidate(const Candidate &candidate);
+
+    /**
+    * @fn void containsCandidates(const Candidate* candidates, size_t count,
+    *                             bool* found)
+    * @brief Indique pour chaque candidat d'un lot si il est contenu dans le
+    *        dictionnaire. Les groupes de tous les candidats sont chargés
+    *        avant la première comparaison.
+    *
+    * @param[in] candidates    candidats à rechercher
+    * @param[in] count         nombre de candidats
+    * @param[out] found        found[i] vaut true si le candidat i est contenu
+    *                          dans le dictionnaire, false sinon
+    */
+    void containsCandidates(const Candidate *candidates, size_t count, bool *found);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par la table et les mots.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn const FlatHashSet& getSet() const
+    * @brief Obtient la table de hachage du dictionnaire.
+    *
+    * @return table de hachage du dictionnaire.
+    */
+    const FlatHashSet &getSet() const;
+
+
+private:
+    /**
+    * @var   FlatHashSet set
+    * @brief Table de hachage pour stocker les mots du dictionnaire.
+    */
+    FlatHashSet set;
+};
+
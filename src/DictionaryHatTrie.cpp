@@ -0,0 +1,61 @@
+/**
+*  @file DictionaryHatTrie.cpp
+*  @brief Modélise un dictionnaire avec un HAT-trie.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <fstream>
+
+#include "DictionaryHatTrie.h"
+#include "Tools.h"
+
+DictionaryHatTrie::DictionaryHatTrie(const std::string &filename) : IDictionary(filename) {
+    std::string line;
+    std::ifstream stream(filename);
+
+    // Création du dictionnaire.
+    while (std::getline(stream, line))
+        add(strSanitize(line));
+
+    stream.close();
+}
+
+DictionaryHatTrie::~DictionaryHatTrie() {
+    clear();
+}
+
+void DictionaryHatTrie::add(const std::string &word) {
+    if (!word.empty())
+        trie.insert(word);
+}
+
+void DictionaryHatTrie::clear() {
+    trie.clear();
+}
+
+bool DictionaryHatTrie::empty() const {
+    return trie.size() == 0;
+}
+
+size_t DictionaryHatTrie::remove(const std::string &word) {
+    return trie.remove(word) ? 1 : 0;
+}
+
+bool DictionaryHatTrie::contains(const std::string &str) {
+    return trie.contains(str);
+}
+
+size_t DictionaryHatTrie::size() const {
+    return trie.size();
+}
+
+size_t DictionaryHatTrie::memoryUsage() const {
+    return trie.memoryUsage();
+}
+
+const HatTrie &DictionaryHatTrie::getTrie() const {
+    return trie;
+}
@@ -0,0 +1,110 @@
+/**
+*  @file DictionaryHatTrie.h
+*  @brief Modélise un dictionnaire avec un HAT-trie.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+
+#include "HatTrie.h"
+#include "IDictionary.h"
+
+class DictionaryHatTrie : public IDictionary {
+public:
+    /**
+    * @fn DictionaryHatTrie(const std::string& filename)
+    * @brief Constructeur d'un dictionnaire avec le nom d'un fichier à
+    *        importer.
+    *
+    * @param[in] filename      nom d'un fichier à importer
+    */
+    DictionaryHatTrie(const std::string &filename);
+
+    /**
+    * @fn ~DictionaryHatTrie()
+    * @brief Destructeur d'un dictionnaire, suppression du contenu du
+    *        dictionnaire.
+    */
+    ~DictionaryHatTrie();
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Ajoute un mot au dictionnaire, si il n'y est pas présent.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du dictionnaire.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Supprime le mot du dictionnaire.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return nombre de mots du dictionnaire supprimés.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les noeuds et les paquets du
+    *        trie.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn const HatTrie& getTrie() const
+    * @brief Obtient le trie du dictionnaire.
+    *
+    * @return trie du dictionnaire.
+    */
+    const HatTrie &getTrie() const;
+
+
+private:
+    /**
+    * @var   HatTrie trie
+    * @brief HAT-trie pour stocker les mots du dictionnaire.
+    */
+    HatTrie trie;
+};
+
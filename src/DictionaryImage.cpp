@@ -0,0 +1,213 @@
+/**
+*  @file DictionaryImage.cpp
+*  @brief Modélise l'image binaire d'un dictionnaire : un arbre ternaire de
+*         recherche compilé, interrogeable sur place une fois projeté en
+*         mémoire.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+#include "DictionaryImage.h"
+
+// Signature au début de chaque image.
+#define DICTIONARY_IMAGE_MAGIC "SPCKDICT"
+
+// Version du format, à incrémenter à chaque changement de l'image.
+#define DICTIONARY_IMAGE_VERSION 2
+
+namespace {
+    // Position des sous-arbres parmi les trois liens d'un noeud
+    enum Child {
+        LEFT, MIDDLE, RIGHT
+    };
+}
+
+DictionaryImage::DictionaryImage() {
+    close();
+}
+
+bool DictionaryImage::open(const void *data, size_t size) {
+    close();
+
+    if (!data || size < sizeof(Header))
+        return false;
+
+    const Header *candidate = static_cast<const Header *>(data);
+
+    if (std::memcmp(candidate->magic, DICTIONARY_IMAGE_MAGIC,
+                    sizeof(candidate->magic)) != 0
+        || candidate->version != DICTIONARY_IMAGE_VERSION
+        || candidate->nodeCount == 0)
+        return false;
+
+    // Taille de chaque noeud : trois liens, un caractère et un indicateur
+    const size_t NODE_SIZE = 3 * sizeof(uint32_t) + sizeof(char) + sizeof(uint8_t);
+    if ((size - sizeof(Header)) / NODE_SIZE < candidate->nodeCount)
+        return false;
+
+    const char *payload = static_cast<const char *>(data) + sizeof(Header);
+    header = candidate;
+    links = reinterpret_cast<const uint32_t *>(payload);
+    chars = payload + 3 * sizeof(uint32_t) * header->nodeCount;
+    finals = reinterpret_cast<const uint8_t *>(chars + header->nodeCount);
+
+    return true;
+}
+
+void DictionaryImage::close() {
+    header = nullptr;
+    links = nullptr;
+    chars = nullptr;
+    finals = nullptr;
+}
+
+bool DictionaryImage::isOpen() const {
+    return header != nullptr;
+}
+
+bool DictionaryImage::verify() const {
+    if (!header)
+        return false;
+
+    const size_t NODES = header->nodeCount;
+
+    uint64_t hash = checksum(links, 3 * sizeof(uint32_t) * NODES);
+    hash = checksum(chars, NODES, hash);
+    hash = checksum(finals, NODES, hash);
+
+    return hash == header->checksum;
+}
+
+bool DictionaryImage::contains(const std::string &word) const {
+    if (!header || word.empty() || header->nodeCount < 2)
+        return false;
+
+    const char *key = word.data();
+    const size_t LAST = word.length() - 1;
+    const uint32_t NODES = header->nodeCount;
+
+    // La racine porte toujours l'indice 1.
+    uint32_t node = 1;
+    size_t charIndex = 0;
+
+    // Les noeuds étant numérotés en largeur, chaque lien mène à un indice
+    // plus grand : un lien qui recule ou sort de l'image la rend invalide et
+    // la recherche ne peut donc pas boucler.
+    while (node != 0) {
+        const char c = key[charIndex];
+        const char nodeChar = chars[node];
+        const uint32_t *child = links + 3 * node;
+        uint32_t next;
+
+        if (c < nodeChar)
+            next = child[LEFT];
+        else if (c > nodeChar)
+            next = child[RIGHT];
+        else if (charIndex < LAST) {
+            next = child[MIDDLE];
+            ++charIndex;
+        } else
+            return finals[node] != 0;
+
+        if (next != 0 && (next <= node || next >= NODES))
+            return false;
+
+        node = next;
+    }
+
+    return false;
+}
+
+size_t DictionaryImage::countKeys() const {
+    return header ? header->keyCount : 0;
+}
+
+size_t DictionaryImage::size() const {
+    if (!header)
+        return 0;
+
+    const size_t NODE_SIZE = 3 * sizeof(uint32_t) + sizeof(char) + sizeof(uint8_t);
+    return sizeof(Header) + header->nodeCount * NODE_SIZE;
+}
+
+bool DictionaryImage::readHeader(const std::string &filename, Header &header) {
+    std::ifstream stream(filename, std::ios_base::binary);
+
+    if (!stream.read(reinterpret_cast<char *>(&header), sizeof(header)))
+        return false;
+
+    return std::memcmp(header.magic, DICTIONARY_IMAGE_MAGIC, sizeof(header.magic)) == 0
+           && header.version == DICTIONARY_IMAGE_VERSION;
+}
+
+bool DictionaryImage::isCompiledFrom(const Header &header, const std::string &source) {
+    uint64_t size;
+    int64_t time;
+
+    return sourceStamp(source, size, time)
+           && header.sourceSize == size && header.sourceTime == time;
+}
+
+uint64_t DictionaryImage::checksum(const void *data, size_t size, uint64_t hash) {
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+bool DictionaryImage::write(const std::string &filename,
+                            const std::vector<uint32_t> &links,
+                            const std::vector<char> &chars,
+                            const std::vector<uint8_t> &finals,
+                            size_t keyCount, const std::string &source) {
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, DICTIONARY_IMAGE_MAGIC, sizeof(header.magic));
+    header.version = DICTIONARY_IMAGE_VERSION;
+    header.nodeCount = (uint32_t) chars.size();
+    header.keyCount = keyCount;
+
+    // Sans fichier texte, l'image ne correspond à aucune source.
+    if (!sourceStamp(source, header.sourceSize, header.sourceTime))
+        header.sourceTime = header.sourceSize = 0;
+
+    const size_t LINKS_SIZE = links.size() * sizeof(uint32_t);
+
+    header.checksum = checksum(links.data(), LINKS_SIZE);
+    header.checksum = checksum(chars.data(), chars.size(), header.checksum);
+    header.checksum = checksum(finals.data(), finals.size(), header.checksum);
+
+    std::ofstream stream(filename, std::ios_base::binary | std::ios_base::trunc);
+
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char *>(links.data()), LINKS_SIZE);
+    stream.write(chars.data(), chars.size());
+    stream.write(reinterpret_cast<const char *>(finals.data()), finals.size());
+    stream.close();
+
+    return !stream.fail();
+}
+
+bool DictionaryImage::sourceStamp(const std::string &source, uint64_t &size,
+                                  int64_t &time) {
+    std::error_code error;
+    const std::filesystem::path path(source);
+
+    size = std::filesystem::file_size(path, error);
+    if (error)
+        return false;
+
+    time = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+    return !error;
+}
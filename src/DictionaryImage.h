@@ -0,0 +1,254 @@
+/**
+*  @file DictionaryImage.h
+*  @brief Modélise l'image binaire d'un dictionnaire : un arbre ternaire de
+*         recherche compilé, interrogeable sur place une fois projeté en
+*         mémoire.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+* Format du fichier, tous les entiers en ordre natif :
+*
+*   Header                    en-tête de taille fixe
+*   uint32_t links[n][3]      sous-arbres gauche, central et droit
+*   char     chars[n]         caractère de chaque noeud
+*   uint8_t  finals[n]        1 si une clé se termine sur le noeud
+*
+* Les noeuds sont numérotés en largeur depuis la racine, qui porte l'indice
+* 1. L'indice 0 représente l'absence de noeud. Les liens sont donc des
+* positions relatives au début des tableaux et l'image ne contient aucun
+* pointeur.
+*/
+class DictionaryImage {
+public:
+    /**
+    * @var   struct Header
+    * @brief En-tête du fichier.
+    */
+    struct Header {
+        char magic[8];       // DICTIONARY_IMAGE_MAGIC
+        uint32_t version;    // DICTIONARY_IMAGE_VERSION
+        uint32_t nodeCount;  // nombre de noeuds, l'indice 0 compris
+        uint64_t keyCount;   // nombre de clés de l'arbre
+        uint64_t checksum;   // somme de contrôle des tableaux
+        uint64_t sourceSize; // taille du fichier texte compilé
+        int64_t sourceTime;  // date de modification du fichier texte compilé
+    };
+
+    /**
+    * @fn DictionaryImage()
+    * @brief Constructeur d'une image vide.
+    */
+    DictionaryImage();
+
+    /**
+    * @fn bool open(const void* data, size_t size)
+    * @brief Interprète la mémoire comme une image de dictionnaire. Seuls l'en-tête
+    *        et les tailles sont vérifiés, en temps constant : les liens le
+    *        sont au fil des recherches et la somme de contrôle par verify().
+    *        La mémoire n'est pas copiée et doit rester valide.
+    *
+    * @param[in] data    début de l'image
+    * @param[in] size    taille de l'image en octets
+    *
+    * @return true si l'image est valide, false sinon.
+    */
+    bool open(const void *data, size_t size);
+
+    /**
+    * @fn void close()
+    * @brief Oublie l'image courante.
+    */
+    void close();
+
+    /**
+    * @fn bool isOpen() const
+    * @brief Indique si une image valide est ouverte.
+    *
+    * @return true si une image est ouverte, false sinon.
+    */
+    bool isOpen() const;
+
+    /**
+    * @fn bool verify() const
+    * @brief Recalcule la somme de contrôle des tableaux et la compare à
+    *        celle de l'en-tête.
+    *
+    * @return true si l'image est intacte, false sinon.
+    */
+    bool verify() const;
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est une clé de l'image.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans l'image, false sinon.
+    */
+    bool contains(const std::string &word) const;
+
+    /**
+    * @fn size_t countKeys() const
+    * @brief Obtient le nombre de clés de l'image.
+    *
+    * @return nombre de clés.
+    */
+    size_t countKeys() const;
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient la taille de l'image en octets.
+    *
+    * @return taille de l'image.
+    */
+    size_t size() const;
+
+    /**
+    * @fn static bool readHeader(const std::string& filename, Header& header)
+    * @brief Lis l'en-tête d'une image sans projeter le fichier.
+    *
+    * @param[in] filename    nom de l'image
+    * @param[out] header     en-tête lu
+    *
+    * @return true si l'en-tête est celui d'une image de la version
+    *         courante, false sinon.
+    */
+    static bool readHeader(const std::string &filename, Header &header);
+
+    /**
+    * @fn static bool isCompiledFrom(const Header& header,
+    *                                const std::string& source)
+    * @brief Indique si l'en-tête est celui d'une image compilée depuis le
+    *        fichier texte dans son état actuel : même taille et même date de
+    *        modification.
+    *
+    * @param[in] header   en-tête de l'image
+    * @param[in] source   nom du fichier texte du dictionnaire
+    *
+    * @return true si l'image correspond au fichier, false sinon.
+    */
+    static bool isCompiledFrom(const Header &header, const std::string &source);
+
+    /**
+    * @fn template <typename TreeType>
+    *     static bool write(const std::string& filename, const TreeType& tree,
+    *                       size_t keyCount, const std::string& source)
+    * @brief Ecris l'image d'un arbre ternaire de recherche dans un fichier.
+    *        L'arbre est parcouru par ses Handle, sa forme est conservée.
+    *
+    * @param[in] filename    nom du fichier à écrire
+    * @param[in] tree        arbre à écrire
+    * @param[in] keyCount    nombre de clés de l'arbre
+    * @param[in] source      fichier texte dont l'arbre est issu, dont la
+    *                        taille et la date sont notées dans l'en-tête
+    *
+    * @return true si le fichier a été écrit, false sinon.
+    */
+    template<typename TreeType>
+    static bool write(const std::string &filename, const TreeType &tree,
+                      size_t keyCount, const std::string &source) {
+        typedef typename TreeType::Handle Handle;
+
+        // Noeuds dans l'ordre de leur numérotation, à partir de 1
+        std::vector<Handle> order;
+        std::vector<uint32_t> links(3, 0);
+        std::vector<char> chars(1, 0);
+        std::vector<uint8_t> finals(1, 0);
+
+        if (tree.getRoot() != Handle())
+            order.push_back(tree.getRoot());
+
+        for (size_t i = 0; i < order.size(); ++i) {
+            const Handle node = order[i];
+
+            for (Handle child : {tree.getLeft(node), tree.getMiddle(node),
+                                 tree.getRight(node)}) {
+                if (child == Handle()) {
+                    links.push_back(0);
+                } else {
+                    order.push_back(child);
+                    links.push_back((uint32_t) order.size());
+                }
+            }
+
+            chars.push_back(tree.getChar(node));
+            finals.push_back(tree.getValue(node) ? 1 : 0);
+        }
+
+        return write(filename, links, chars, finals, keyCount, source);
+    }
+
+    /**
+    * @fn static uint64_t checksum(const void* data, size_t size,
+    *                              uint64_t hash)
+    * @brief Calcule la somme de contrôle FNV-1a (64 bits) des données.
+    *
+    * @param[in] data    début des données
+    * @param[in] size    taille des données en octets
+    * @param[in] hash    somme des données précédentes
+    *
+    * @return somme de contrôle.
+    */
+    static uint64_t checksum(const void *data, size_t size,
+                             uint64_t hash = 14695981039346656037ULL);
+
+private:
+    /**
+    * @fn static bool write(const std::string& filename,
+    *                       const std::vector<uint32_t>& links,
+    *                       const std::vector<char>& chars,
+    *                       const std::vector<uint8_t>& finals,
+    *                       size_t keyCount, const std::string& source)
+    * @brief Ecris l'en-tête et les tableaux dans un fichier.
+    */
+    static bool write(const std::string &filename,
+                      const std::vector<uint32_t> &links,
+                      const std::vector<char> &chars,
+                      const std::vector<uint8_t> &finals,
+                      size_t keyCount, const std::string &source);
+
+    /**
+    * @fn static bool sourceStamp(const std::string& source, uint64_t& size,
+    *                             int64_t& time)
+    * @brief Obtient la taille et la date de modification d'un fichier.
+    *
+    * @return true si le fichier existe, false sinon.
+    */
+    static bool sourceStamp(const std::string &source, uint64_t &size,
+                            int64_t &time);
+
+    /**
+    * @var   const Header* header
+    * @brief En-tête de l'image, nul si aucune image n'est ouverte.
+    */
+    const Header *header;
+
+    /**
+    * @var   const uint32_t* links
+    * @brief Liens des noeuds, trois par noeud.
+    */
+    const uint32_t *links;
+
+    /**
+    * @var   const char* chars
+    * @brief Caractère de chaque noeud.
+    */
+    const char *chars;
+
+    /**
+    * @var   const uint8_t* finals
+    * @brief Indique pour chaque noeud si une clé s'y termine.
+    */
+    const uint8_t *finals;
+};
@@ -0,0 +1,76 @@
+/**
+*  @file DictionaryLouds.cpp
+*  @brief Modélise un dictionnaire avec un trie succinct (LOUDS).
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <vector>
+
+#include "DictionaryLouds.h"
+#include "Tools.h"
+
+DictionaryLouds::DictionaryLouds(const std::string &filename) : IDictionary(filename) {
+    // Le trie se construit à partir des mots triés et sans doublon.
+    std::vector<std::string> words(loadSortedWords(filename));
+
+    louds.build(words);
+}
+
+DictionaryLouds::~DictionaryLouds() {
+    clear();
+}
+
+void DictionaryLouds::add(const std::string &word) {
+    if (word.empty())
+        return;
+
+    if (louds.contains(word))
+        removed.erase(word);
+    else
+        added.insert(word);
+}
+
+void DictionaryLouds::clear() {
+    louds.clear();
+    added.clear();
+    removed.clear();
+}
+
+bool DictionaryLouds::empty() const {
+    return size() == 0;
+}
+
+size_t DictionaryLouds::remove(const std::string &word) {
+    if (added.erase(word))
+        return 1;
+
+    if (louds.contains(word) && removed.insert(word).second)
+        return 1;
+
+    return 0;
+}
+
+bool DictionaryLouds::contains(const std::string &str) {
+    if (str.empty())
+        return false;
+
+    if (louds.contains(str))
+        return removed.empty() || removed.find(str) == removed.end();
+
+    return !added.empty() && added.find(str) != added.end();
+}
+
+size_t DictionaryLouds::size() const {
+    return louds.countKeys() - removed.size() + added.size();
+}
+
+size_t DictionaryLouds::memoryUsage() const {
+    return louds.memoryUsage() + ::memoryUsage(added) + ::memoryUsage(removed);
+}
+
+const Louds &DictionaryLouds::getLouds() const {
+    return louds;
+}
@@ -0,0 +1,123 @@
+/**
+*  @file DictionaryLouds.h
+*  @brief Modélise un dictionnaire avec un trie succinct (LOUDS).
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_set>
+
+#include "Louds.h"
+#include "IDictionary.h"
+
+class DictionaryLouds : public IDictionary {
+public:
+    /**
+    * @fn DictionaryLouds(const std::string& filename)
+    * @brief Constructeur d'un dictionnaire avec le nom d'un fichier à
+    *        importer. Les mots sont triés puis compilés en trie.
+    *
+    * @param[in] filename      nom d'un fichier à importer
+    */
+    DictionaryLouds(const std::string &filename);
+
+    /**
+    * @fn ~DictionaryLouds()
+    * @brief Destructeur d'un dictionnaire, suppression du contenu du
+    *        dictionnaire.
+    */
+    ~DictionaryLouds();
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Ajoute un mot au dictionnaire, si il n'y est pas présent.
+    *        Le trie n'est pas modifié, le mot est gardé à part.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du dictionnaire.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Supprime le mot du dictionnaire. Un mot du trie est
+    *        seulement marqué comme supprimé.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return nombre de mots du dictionnaire supprimés.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire utilisée par le trie et par les mots
+    *        ajoutés ou supprimés après sa construction.
+    *
+    * @return nombre d'octets utilisés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn const Louds& getLouds() const
+    * @brief Obtient le trie du dictionnaire.
+    *
+    * @return trie du dictionnaire.
+    */
+    const Louds &getLouds() const;
+
+private:
+    /**
+    * @var   Louds louds
+    * @brief Trie des mots du fichier.
+    */
+    Louds louds;
+
+    /**
+    * @var   std::unordered_set<std::string> added
+    * @brief Mots ajoutés après la construction du trie.
+    */
+    std::unordered_set<std::string> added;
+
+    /**
+    * @var   std::unordered_set<std::string> removed
+    * @brief Mots du trie supprimés après sa construction.
+    */
+    std::unordered_set<std::string> removed;
+};
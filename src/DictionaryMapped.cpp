@@ -0,0 +1,79 @@
+/**
+*  @file DictionaryMapped.cpp
+*  @brief Modélise un dictionnaire en lecture seule, interrogé directement
+*         dans son image binaire projetée en mémoire.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "DictionaryMapped.h"
+
+DictionaryMapped::DictionaryMapped(const std::string &filename, bool verify)
+        : IDictionary(filename), mapping(nullptr), mappingSize(0) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+
+    struct stat status;
+    if (fstat(fd, &status) == 0 && status.st_size > 0) {
+        mappingSize = (size_t) status.st_size;
+        mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+
+        if (mapping == MAP_FAILED)
+            mapping = nullptr;
+    }
+
+    // La projection reste valide après la fermeture du descripteur.
+    ::close(fd);
+
+    if (!mapping || !image.open(mapping, mappingSize)
+        || (verify && !image.verify()))
+        clear();
+}
+
+DictionaryMapped::~DictionaryMapped() {
+    clear();
+}
+
+bool DictionaryMapped::isOpen() const {
+    return image.isOpen();
+}
+
+void DictionaryMapped::add(const std::string &) {}
+
+void DictionaryMapped::clear() {
+    image.close();
+
+    if (mapping)
+        munmap(mapping, mappingSize);
+
+    mapping = nullptr;
+    mappingSize = 0;
+}
+
+bool DictionaryMapped::empty() const {
+    return image.countKeys() == 0;
+}
+
+size_t DictionaryMapped::remove(const std::string &) {
+    return 0;
+}
+
+bool DictionaryMapped::contains(const std::string &str) {
+    return image.contains(str);
+}
+
+size_t DictionaryMapped::size() const {
+    return image.countKeys();
+}
+
+size_t DictionaryMapped::memoryUsage() const {
+    return mappingSize;
+}
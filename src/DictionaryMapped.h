@@ -0,0 +1,128 @@
+/**
+*  @file DictionaryMapped.h
+*  @brief Modélise un dictionnaire en lecture seule, interrogé directement
+*         dans son image binaire projetée en mémoire.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+
+#include "DictionaryImage.h"
+#include "IDictionary.h"
+
+class DictionaryMapped : public IDictionary {
+public:
+    /**
+    * @fn DictionaryMapped(const std::string& filename, bool verify = false)
+    * @brief Constructeur d'un dictionnaire avec le nom d'une image binaire,
+    *        écrite par DictionaryTree::save ou DictionarySet::save. Le
+    *        fichier est projeté en mémoire sans être lu ni analysé. Si le
+    *        fichier est absent ou invalide, le dictionnaire est vide.
+    *
+    * @param[in] filename      nom de l'image à projeter
+    * @param[in] verify        vérifie la somme de contrôle, ce qui lit
+    *                          toute l'image
+    */
+    DictionaryMapped(const std::string &filename, bool verify = false);
+
+    /**
+    * @fn ~DictionaryMapped()
+    * @brief Destructeur d'un dictionnaire, libération de la projection.
+    */
+    ~DictionaryMapped();
+
+    DictionaryMapped(const DictionaryMapped &) = delete;
+
+    DictionaryMapped &operator=(const DictionaryMapped &) = delete;
+
+    /**
+    * @fn bool isOpen() const
+    * @brief Indique si l'image a pu être projetée et est valide.
+    *
+    * @return true si l'image est ouverte, false sinon.
+    */
+    bool isOpen() const;
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Sans effet, le dictionnaire est en lecture seule.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Libère la projection, le dictionnaire devient vide.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Sans effet, le dictionnaire est en lecture seule.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return 0, aucun mot n'est supprimé.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la taille de la projection. Ses pages sont partagées
+    *        entre les processus qui projettent le même fichier.
+    *
+    * @return nombre d'octets projetés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @var   void* mapping
+    * @brief Début de la projection, nul si aucun fichier n'est projeté.
+    */
+    void *mapping;
+
+    /**
+    * @var   size_t mappingSize
+    * @brief Taille de la projection en octets.
+    */
+    size_t mappingSize;
+
+    /**
+    * @var   DictionaryImage image
+    * @brief Image du dictionnaire dans la projection.
+    */
+    DictionaryImage image;
+};
@@ -0,0 +1,71 @@
+/**
+*  @file DictionaryPacked.cpp
+*  @brief Modélise un dictionnaire dont les mots courts sont rangés dans des
+*         clés de 128 bits.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "DictionaryPacked.h"
+#include "Tools.h"
+
+DictionaryPacked::DictionaryPacked(const std::string &filename) : IDictionary(filename) {
+    std::string line;
+    std::ifstream stream(filename);
+
+    // Dimensionnement de la table des clés, un mot par ligne au plus
+    set.reserve((size_t) std::count(std::istreambuf_iterator<char>(stream),
+                                    std::istreambuf_iterator<char>(), '\n') + 1);
+
+    stream.clear();
+    stream.seekg(0);
+
+    // Création du dictionnaire.
+    while (std::getline(stream, line))
+        add(strSanitize(line));
+
+    stream.close();
+}
+
+DictionaryPacked::~DictionaryPacked() {
+    clear();
+}
+
+void DictionaryPacked::add(const std::string &word) {
+    if (!word.empty())
+        set.insert(word);
+}
+
+void DictionaryPacked::clear() {
+    set.clear();
+}
+
+bool DictionaryPacked::empty() const {
+    return set.size() == 0;
+}
+
+size_t DictionaryPacked::remove(const std::string &word) {
+    return set.erase(word);
+}
+
+bool DictionaryPacked::contains(const std::string &str) {
+    return set.contains(str);
+}
+
+size_t DictionaryPacked::size() const {
+    return set.size();
+}
+
+size_t DictionaryPacked::memoryUsage() const {
+    return set.memoryUsage();
+}
+
+const PackedWordSet &DictionaryPacked::getSet() const {
+    return set;
+}
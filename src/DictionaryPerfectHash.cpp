@@ -0,0 +1,63 @@
+/**
+*  @file DictionaryPerfectHash.cpp
+*  @brief Modélise un dictionnaire figé, indexé par une fonction de hachage
+*         parfaite minimale.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "DictionaryPerfectHash.h"
+#include "Tools.h"
+
+DictionaryPerfectHash::DictionaryPerfectHash(const std::string &filename)
+        : IDictionary(filename) {
+    std::vector<std::string> words(loadSortedWords(filename));
+
+    if (!set.build(words)) {
+        std::cerr << "Unable to build the perfect hash function of '"
+                  << filename << "'." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+void DictionaryPerfectHash::add(const std::string &) {}
+
+void DictionaryPerfectHash::clear() {
+    set.clear();
+}
+
+bool DictionaryPerfectHash::empty() const {
+    return set.size() == 0;
+}
+
+size_t DictionaryPerfectHash::remove(const std::string &) {
+    return 0;
+}
+
+bool DictionaryPerfectHash::contains(const std::string &str) {
+    return set.contains(str);
+}
+
+bool DictionaryPerfectHash::containsCandidate(const Candidate &candidate) {
+    return set.contains(candidate.hash, [&candidate](const char *data, size_t length) {
+        return candidate.equals(data, length);
+    });
+}
+
+size_t DictionaryPerfectHash::size() const {
+    return set.size();
+}
+
+size_t DictionaryPerfectHash::memoryUsage() const {
+    return set.memoryUsage();
+}
+
+const PerfectHashSet &DictionaryPerfectHash::getSet() const {
+    return set;
+}
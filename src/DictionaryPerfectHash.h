@@ -0,0 +1,115 @@
+/**
+*  @file DictionaryPerfectHash.h
+*  @brief Modélise un dictionnaire figé, indexé par une fonction de hachage
+*         parfaite minimale.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+
+#include "IDictionary.h"
+#include "PerfectHashSet.h"
+
+class DictionaryPerfectHash : public IDictionary {
+public:
+    /**
+    * @fn DictionaryPerfectHash(const std::string& filename)
+    * @brief Constructeur d'un dictionnaire avec le nom d'un fichier à
+    *        importer. La fonction de hachage est construite une fois pour
+    *        tous les mots, le dictionnaire est ensuite en lecture seule.
+    *        Le programme s'arrête si elle ne peut pas être construite.
+    *
+    * @param[in] filename      nom d'un fichier à importer
+    */
+    DictionaryPerfectHash(const std::string &filename);
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Sans effet, le dictionnaire est en lecture seule.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du dictionnaire.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Sans effet, le dictionnaire est en lecture seule.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return 0, aucun mot n'est supprimé.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn bool containsCandidate(const Candidate& candidate)
+    * @brief Indique si un candidat de correction est contenu dans le
+    *        dictionnaire. Il est comparé au seul mot de la case de son
+    *        empreinte sans être construit.
+    *
+    * @param[in] candidate     candidat à rechercher
+    *
+    * @return true si le candidat est contenu dans le dictionnaire, false sinon
+    */
+    bool containsCandidate(const Candidate &candidate);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les pilotes et les mots.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn const PerfectHashSet& getSet() const
+    * @brief Obtient l'ensemble des mots du dictionnaire.
+    *
+    * @return ensemble des mots du dictionnaire.
+    */
+    const PerfectHashSet &getSet() const;
+
+private:
+    /**
+    * @var   PerfectHashSet set
+    * @brief Ensemble des mots du fichier.
+    */
+    PerfectHashSet set;
+};
@@ -0,0 +1,94 @@
+/**
+*  @file DictionarySearchTree.cpp
+*  @brief Modélise un dictionnaire avec un arbre binaire de recherche.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <vector>
+
+#include "DictionarySearchTree.h"
+#include "Tools.h"
+
+template<typename TreeType>
+BasicDictionarySearchTree<TreeType>::BasicDictionarySearchTree(const std::string &filename)
+        : IDictionary(filename) {
+    // L'arbre se construit à partir des mots triés et sans doublon.
+    std::vector<std::string> words(loadSortedWords(filename));
+
+    tree.build(words, true);
+}
+
+template<typename TreeType>
+BasicDictionarySearchTree<TreeType>::~BasicDictionarySearchTree() {
+    clear();
+}
+
+template<typename TreeType>
+void BasicDictionarySearchTree<TreeType>::add(const std::string &word) {
+    if (!word.empty())
+        tree.put(word, true);
+}
+
+template<typename TreeType>
+void BasicDictionarySearchTree<TreeType>::clear() {
+    tree.clear();
+}
+
+template<typename TreeType>
+bool BasicDictionarySearchTree<TreeType>::empty() const {
+    return tree.size() == 0;
+}
+
+template<typename TreeType>
+size_t BasicDictionarySearchTree<TreeType>::remove(const std::string &word) {
+    if (!tree.contains(word))
+        return 0;
+
+    tree.deleteElement(word);
+    return 1;
+}
+
+template<typename TreeType>
+bool BasicDictionarySearchTree<TreeType>::contains(const std::string &str) {
+    return tree.contains(str);
+}
+
+template<typename TreeType>
+size_t BasicDictionarySearchTree<TreeType>::size() const {
+    return (size_t) tree.size();
+}
+
+template<typename TreeType>
+size_t BasicDictionarySearchTree<TreeType>::memoryUsage() const {
+    const size_t SHORT_STRING = std::string().capacity();
+    size_t bytes = size() * TreeType::NODE_SIZE;
+
+    tree.visitInOrder([&](const std::string &word, bool) {
+        if (word.capacity() > SHORT_STRING)
+            bytes += word.capacity() + 1;
+    });
+
+    return bytes;
+}
+
+template<typename TreeType>
+size_t BasicDictionarySearchTree<TreeType>::height() const {
+    return (size_t) tree.height();
+}
+
+template<typename TreeType>
+size_t BasicDictionarySearchTree<TreeType>::rank(const std::string &word) const {
+    return (size_t) tree.rank(word);
+}
+
+template<typename TreeType>
+std::string BasicDictionarySearchTree<TreeType>::select(size_t rank) const {
+    return tree.select((int) rank);
+}
+
+// Arbres pouvant être utilisés par le dictionnaire
+template class BasicDictionarySearchTree<AVLTree<std::string, bool>>;
+template class BasicDictionarySearchTree<BinarySearchTree<std::string, bool>>;
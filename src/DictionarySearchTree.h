@@ -0,0 +1,146 @@
+/**
+*  @file DictionarySearchTree.h
+*  @brief Modélise un dictionnaire avec un arbre binaire de recherche.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+
+#include "AVLTree.h"
+#include "BinarySearchTree.h"
+#include "IDictionary.h"
+
+template<typename TreeType>
+class BasicDictionarySearchTree : public IDictionary {
+public:
+    /**
+    * @fn BasicDictionarySearchTree(const std::string& filename)
+    * @brief Constructeur d'un dictionnaire avec le nom d'un fichier à
+    *        importer. Les mots sont triés puis l'arbre équilibré est
+    *        construit en une passe, sans rotation.
+    *
+    * @param[in] filename      nom d'un fichier à importer
+    */
+    BasicDictionarySearchTree(const std::string &filename);
+
+    /**
+    * @fn ~BasicDictionarySearchTree()
+    * @brief Destructeur d'un dictionnaire, suppression du contenu du
+    *        dictionnaire.
+    */
+    ~BasicDictionarySearchTree();
+
+    /**
+    * @fn void add(const std::string& word)
+    * @brief Ajoute un mot au dictionnaire, si il n'y est pas présent.
+    *
+    * @param[in] word      mot à ajouter au dictionnaire
+    */
+    void add(const std::string &word);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du dictionnaire.
+    */
+    void clear();
+
+    /**
+    * @fn bool empty() const
+    * @brief Indique si le dictionnaire est vide.
+    *
+    * @return true si le dictionnaire est vide, false sinon.
+    */
+    bool empty() const;
+
+    /**
+    * @fn size_t remove(const std::string& word)
+    * @brief Supprime le mot du dictionnaire.
+    *
+    * @param[in] word      mot à supprimer au dictionnaire
+    *
+    * @return nombre de mots du dictionnaire supprimés.
+    */
+    size_t remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word)
+    * @brief Indique si le mot recherché est contenu dans le dictionnaire.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le dictionnaire, false sinon
+    */
+    bool contains(const std::string &word);
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots contenus dans dictionnaire.
+    *
+    * @return nombre de mots contenus dans le dictionnaire.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient une estimation de la mémoire utilisée par l'arbre : un
+    *        noeud par mot et les chaînes trop longues pour être stockées
+    *        dans std::string.
+    *
+    * @return nombre d'octets utilisés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn size_t height() const
+    * @brief Obtient la hauteur de l'arbre du dictionnaire.
+    *
+    * @return hauteur de l'arbre.
+    */
+    size_t height() const;
+
+    /**
+    * @fn size_t rank(const std::string& word) const
+    * @brief Obtient le nombre de mots du dictionnaire avant un mot, qui n'y
+    *        est pas forcément. Le coût est celui d'une recherche.
+    *
+    * @param[in] word     mot dont le rang est cherché
+    *
+    * @return rang du mot.
+    */
+    size_t rank(const std::string &word) const;
+
+    /**
+    * @fn std::string select(size_t rank) const
+    * @brief Obtient le mot d'un rang donné. Le coût est celui d'une
+    *        recherche.
+    *
+    * @param[in] rank     rang du mot, inférieur à size()
+    *
+    * @return mot du rang.
+    */
+    std::string select(size_t rank) const;
+
+private:
+    /**
+    * @var   TreeType tree
+    * @brief Arbre binaire de recherche pour stocker les mots du dictionnaire.
+    */
+    TreeType tree;
+};
+
+/**
+* @typedef BasicDictionarySearchTree<AVLTree<std::string, bool>> DictionaryAVL
+* @brief Dictionnaire sur un arbre AVL.
+*/
+typedef BasicDictionarySearchTree<AVLTree<std::string, bool>> DictionaryAVL;
+
+/**
+* @typedef BasicDictionarySearchTree<BinarySearchTree<std::string, bool>> DictionaryBST
+* @brief Dictionnaire sur un arbre binaire de recherche sans équilibrage.
+*/
+typedef BasicDictionarySearchTree<BinarySearchTree<std::string, bool>> DictionaryBST;
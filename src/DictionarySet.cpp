@@ -8,8 +8,10 @@
 */
 
 #include <fstream>
+#include <vector>
 
 #include "DictionarySet.h"
+#include "DictionaryTree.h"
 #include "Tools.h"
 
 DictionarySet::DictionarySet(const std::string &filename) : IDictionary(filename) {
@@ -28,11 +30,16 @@ DictionarySet::~DictionarySet() {
 }
 
 void DictionarySet::add(const std::string &word) {
-    set.insert(word);
+    // Le mot n'est copié dans le pool que si il est nouveau.
+    const Key KEY = makeKey(word);
+
+    if (set.find(KEY) == set.end())
+        set.insert(Key{pool.append(word), KEY.hash});
 }
 
 void DictionarySet::clear() {
     set.clear();
+    pool.clear();
 }
 
 bool DictionarySet::empty() const {
@@ -40,17 +47,50 @@ bool DictionarySet::empty() const {
 }
 
 size_t DictionarySet::remove(const std::string &word) {
-    return set.erase(word);
+    return set.erase(makeKey(word));
 }
 
 bool DictionarySet::contains(const std::string &str) {
-    if (str.length() && set.find(str) != set.end())
+    if (str.length() && set.find(makeKey(str)) != set.end())
         return true;
 
     return false;
 }
 
+bool DictionarySet::containsCandidate(const Candidate &candidate) {
+    if (candidate.length() == 0)
+        return false;
+
+    const size_t BUCKET = set.bucket(Key{std::string_view(), candidate.hash});
+
+    for (auto it = set.begin(BUCKET); it != set.end(BUCKET); ++it)
+        if (it->hash == candidate.hash
+            && candidate.equals(it->word.data(), it->word.length()))
+            return true;
+
+    return false;
+}
+
 size_t DictionarySet::size() const {
     return set.size();
 }
 
+size_t DictionarySet::memoryUsage() const {
+    // Noeud : lien vers le suivant et clé, dont l'empreinte du mot
+    const size_t NODE_SIZE = sizeof(void *) + sizeof(Key);
+
+    return set.bucket_count() * sizeof(void *) + set.size() * NODE_SIZE
+           + pool.capacity();
+}
+
+bool DictionarySet::save(const std::string &filename) const {
+    std::vector<std::string> words;
+    words.reserve(set.size());
+
+    for (const Key &key : set)
+        words.emplace_back(key.word);
+
+    DictionaryFlatTree tree(getFilename(), words);
+
+    return tree.save(filename);
+}
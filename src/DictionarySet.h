@@ -9,10 +9,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 
+#include "Hash.h"
 #include "IDictionary.h"
+#include "StringPool.h"
 
 class DictionarySet : public IDictionary {
 public:
@@ -35,6 +39,7 @@ public:
     /**
     * @fn void add(const std::string& word)
     * @brief Ajoute un mot au dictionnaire, si il n'y est pas présent.
+    *        Le mot est copié à la suite du pool.
     *
     * @param[in] word      mot à ajouter au dictionnaire
     */
@@ -56,7 +61,8 @@ public:
 
     /**
     * @fn size_t remove(const std::string& word)
-    * @brief Supprime le mot du dictionnaire.
+    * @brief Supprime le mot du dictionnaire. Ses caractères restent dans
+    *        le pool jusqu'à clear().
     *
     * @param[in] word      mot à supprimer au dictionnaire
     *
@@ -74,6 +80,18 @@ public:
     */
     bool contains(const std::string &word);
 
+    /**
+    * @fn bool containsCandidate(const Candidate& candidate)
+    * @brief Indique si un candidat de correction est contenu dans le
+    *        dictionnaire. Seule l'alvéole de son empreinte est parcourue et
+    *        ses mots sont comparés au candidat sans le construire.
+    *
+    * @param[in] candidate     candidat à rechercher
+    *
+    * @return true si le candidat est contenu dans le dictionnaire, false sinon
+    */
+    bool containsCandidate(const Candidate &candidate);
+
     /**
     * @fn size_t size() const
     * @brief Obtient le nombre de mots contenus dans dictionnaire.
@@ -82,11 +100,79 @@ public:
     */
     size_t size() const;
 
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient une estimation de la mémoire utilisée par la table de
+    *        hachage : tableau des alvéoles, un noeud par mot et les blocs du
+    *        pool.
+    *
+    * @return nombre d'octets utilisés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn bool save(const std::string& filename) const
+    * @brief Ecris l'image binaire du dictionnaire, lisible par
+    *        DictionaryMapped. Les mots sont d'abord rangés dans un arbre
+    *        ternaire de recherche équilibré.
+    *
+    * @param[in] filename      nom du fichier à écrire
+    *
+    * @return true si le fichier a été écrit, false sinon.
+    */
+    bool save(const std::string &filename) const;
+
 private:
     /**
-    * @var   std::unordered_set<std::string> set
-    * @brief Table de hachage pour stocker les mots du dictionnaire.
+    * @var   struct Key
+    * @brief Vue sur un mot du pool et son empreinte hashWord(), calculée une
+    *        seule fois.
+    */
+    struct Key {
+        std::string_view word;
+        uint64_t hash;
+    };
+
+    /**
+    * @var   struct KeyHash
+    * @brief Fonction de hachage de la table : l'empreinte mémorisée.
+    */
+    struct KeyHash {
+        size_t operator()(const Key &key) const noexcept {
+            return (size_t) key.hash;
+        }
+    };
+
+    /**
+    * @var   struct KeyEqual
+    * @brief Egalité des mots de deux clés.
+    */
+    struct KeyEqual {
+        bool operator()(const Key &a, const Key &b) const noexcept {
+            return a.hash == b.hash && a.word == b.word;
+        }
+    };
+
+    /**
+    * @fn static Key makeKey(std::string_view word)
+    * @brief Obtient la clé d'un mot.
+    */
+    static Key makeKey(std::string_view word) {
+        return Key{word, hashWord(word.data(), word.length())};
+    }
+
+    /**
+    * @var   StringPool<> pool
+    * @brief Caractères des mots du dictionnaire, à la suite.
+    */
+    StringPool<> pool;
+
+    /**
+    * @var   std::unordered_set<Key, KeyHash, KeyEqual> set
+    * @brief Table de hachage des mots du dictionnaire, des vues sur le pool.
+    *        L'empreinte d'un mot est celle des candidats de Candidate.h, qui
+    *        y sont cherchés sans être construits.
     */
-    std::unordered_set<std::string> set;
+    std::unordered_set<Key, KeyHash, KeyEqual> set;
 };
 
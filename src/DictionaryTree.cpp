@@ -7,51 +7,243 @@
 *  @version 1.0
 */
 
+#include <algorithm>
 #include <fstream>
+#include <utility>
+#include <vector>
 
+#include "DictionaryImage.h"
 #include "DictionaryTree.h"
 #include "Tools.h"
 
-DictionaryTree::DictionaryTree(const std::string &filename) : IDictionary(filename) {
+template<typename TreeType>
+BasicDictionaryTree<TreeType>::BasicDictionaryTree(const std::string &filename)
+        : IDictionary(filename) {
     std::string line;
     std::ifstream stream(filename);
+    std::vector<std::string> words;
 
-    // Cr�ation du dictionnaire.
+    // Lecture des mots du dictionnaire.
     while (std::getline(stream, line))
-        add(strSanitize(line));
+        words.push_back(strSanitize(line));
 
     stream.close();
+
+    // Création du dictionnaire.
+    build(words);
+}
+
+template<typename TreeType>
+BasicDictionaryTree<TreeType>::BasicDictionaryTree(const std::string &filename,
+                                                   std::vector<std::string> &words)
+        : IDictionary(filename) {
+    build(words);
 }
 
-DictionaryTree::~DictionaryTree() {
+template<typename TreeType>
+BasicDictionaryTree<TreeType>::~BasicDictionaryTree() {
     clear();
 }
 
-void DictionaryTree::add(const std::string &word) {
+template<typename TreeType>
+void BasicDictionaryTree<TreeType>::add(const std::string &word) {
     size_t value = 0;
     tree.put(word, ++value);
 }
 
-void DictionaryTree::clear() {
+template<typename TreeType>
+void BasicDictionaryTree<TreeType>::clear() {
     tree.clear();
 }
 
-bool DictionaryTree::empty() const {
+template<typename TreeType>
+bool BasicDictionaryTree<TreeType>::empty() const {
     return tree.countKeys() == 0;
 }
 
-size_t DictionaryTree::remove(const std::string &word) {
+template<typename TreeType>
+size_t BasicDictionaryTree<TreeType>::remove(const std::string &word) {
     return tree.remove(word);
 }
 
-bool DictionaryTree::contains(const std::string &str) {
+template<typename TreeType>
+bool BasicDictionaryTree<TreeType>::contains(const std::string &str) {
     if (str.length() && tree.contains(str))
         return true;
 
     return false;
 }
 
-size_t DictionaryTree::size() const {
+template<typename TreeType>
+size_t BasicDictionaryTree<TreeType>::size() const {
     return tree.countKeys();
 }
 
+template<typename TreeType>
+size_t BasicDictionaryTree<TreeType>::height() const {
+    return tree.height();
+}
+
+template<typename TreeType>
+size_t BasicDictionaryTree<TreeType>::nodeCount() const {
+    return tree.countNodes();
+}
+
+template<typename TreeType>
+size_t BasicDictionaryTree<TreeType>::memoryUsage() const {
+    return tree.memoryUsage();
+}
+
+template<typename TreeType>
+bool BasicDictionaryTree<TreeType>::save(const std::string &filename) const {
+    return DictionaryImage::write(filename, tree, size(), getFilename());
+}
+
+template<typename TreeType>
+void BasicDictionaryTree<TreeType>::build(std::vector<std::string> &words) {
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+
+    // Intervalles [début, fin) de mots restant à ajouter. Le mot médian de
+    // chaque intervalle est ajouté avant ceux des deux moitiés, ce qui
+    // équilibre les sous-arbres gauche et droit de chaque noeud.
+    std::vector<std::pair<size_t, size_t>> ranges;
+    ranges.emplace_back(0, words.size());
+
+    while (!ranges.empty()) {
+        const size_t BEGIN = ranges.back().first;
+        const size_t END = ranges.back().second;
+        ranges.pop_back();
+
+        if (BEGIN == END)
+            continue;
+
+        const size_t MIDDLE = BEGIN + (END - BEGIN) / 2;
+        add(words[MIDDLE]);
+
+        ranges.emplace_back(MIDDLE + 1, END);
+        ranges.emplace_back(BEGIN, MIDDLE);
+    }
+}
+
+template<typename TreeType>
+void BasicDictionaryTree<TreeType>::suggest(const std::string &word,
+                                            std::vector<Correction> &corrections) const {
+    const size_t LENGTH = word.length();
+    const size_t FIRST = corrections.size();
+
+    if (LENGTH == 0)
+        return;
+
+    // Niveau des noeuds suivant le préfixe word[0, i) et dernier noeud de ce
+    // préfixe, Handle() tant qu'il est vide.
+    Handle level = tree.getRoot();
+    Handle node = Handle();
+
+    for (size_t i = 0; i <= LENGTH; ++i) {
+        // Lettre en trop : le préfixe est suivi de word[i + 1, LENGTH).
+        if (i < LENGTH) {
+            const bool FOUND = i + 1 == LENGTH
+                               ? node != Handle() && tree.getValue(node) != 0
+                               : matchesFrom(findChar(level, word[i + 1]), word, i + 2);
+
+            if (FOUND)
+                corrections.push_back(Correction{1, i, 0, word.substr(0, i)
+                                                          + word.substr(i + 1)});
+        }
+
+        // Lettre manquante ou erronée : seuls les noeuds du niveau sont
+        // essayés à la place des 26 lettres.
+        visitLevel(level, [&](Handle sibling) {
+            const char c = tree.getChar(sibling);
+
+            if (c < 'a' || c > 'z')
+                return;
+
+            if (matchesFrom(sibling, word, i)) {
+                std::string missing = word;
+                missing.insert(i, 1, c);
+                corrections.push_back(Correction{2, i, c, std::move(missing)});
+            }
+
+            if (i < LENGTH && c != word[i] && matchesFrom(sibling, word, i + 1)) {
+                std::string typing = word;
+                typing[i] = c;
+                corrections.push_back(Correction{3, i, c, std::move(typing)});
+            }
+        });
+
+        // Lettres inversées : le préfixe est suivi de word[i + 1], word[i]
+        // puis de word[i + 2, LENGTH).
+        if (i + 1 < LENGTH && word[i] != word[i + 1]) {
+            const Handle SWAPPED = findChar(level, word[i + 1]);
+
+            if (SWAPPED != Handle()
+                && matchesFrom(findChar(tree.getMiddle(SWAPPED), word[i]), word, i + 2)) {
+                std::string swapped = word;
+                std::swap(swapped[i], swapped[i + 1]);
+                corrections.push_back(Correction{4, i, 0, std::move(swapped)});
+            }
+        }
+
+        if (i == LENGTH)
+            break;
+
+        // Aucune correction ne partage un préfixe absent de l'arbre.
+        node = findChar(level, word[i]);
+        if (node == Handle())
+            break;
+
+        level = tree.getMiddle(node);
+    }
+
+    std::sort(corrections.begin() + FIRST, corrections.end());
+}
+
+template<typename TreeType>
+typename BasicDictionaryTree<TreeType>::Handle
+BasicDictionaryTree<TreeType>::findChar(Handle level, char c) const {
+    while (level != Handle()) {
+        const char NODE_CHAR = tree.getChar(level);
+
+        if (c < NODE_CHAR)
+            level = tree.getLeft(level);
+        else if (c > NODE_CHAR)
+            level = tree.getRight(level);
+        else
+            break;
+    }
+
+    return level;
+}
+
+template<typename TreeType>
+bool BasicDictionaryTree<TreeType>::matchesFrom(Handle node, const std::string &word,
+                                                size_t position) const {
+    if (node == Handle())
+        return false;
+
+    for (; position < word.length(); ++position) {
+        node = findChar(tree.getMiddle(node), word[position]);
+
+        if (node == Handle())
+            return false;
+    }
+
+    return tree.getValue(node) != 0;
+}
+
+template<typename TreeType>
+template<typename Function>
+void BasicDictionaryTree<TreeType>::visitLevel(Handle level, Function function) const {
+    // Parcours infixe des noeuds du niveau, par ordre de caractère
+    while (level != Handle()) {
+        visitLevel(tree.getLeft(level), function);
+        function(level);
+        level = tree.getRight(level);
+    }
+}
+
+// Arbres pouvant être utilisés par le dictionnaire
+template class BasicDictionaryTree<TernarySearchTree<size_t>>;
+template class BasicDictionaryTree<FlatTernarySearchTree<size_t>>;
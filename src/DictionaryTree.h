@@ -10,27 +10,42 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
+#include "FlatTernarySearchTree.h"
 #include "IDictionary.h"
+#include "ISuggestionEngine.h"
 #include "TernarySearchTree.h"
 
-class DictionaryTree : public IDictionary {
+template<typename TreeType>
+class BasicDictionaryTree : public IDictionary {
 public:
     /**
-    * @fn DictionaryTree(const std::string& filename)
+    * @fn BasicDictionaryTree(const std::string& filename)
     * @brief Constructeur d'un dictionnaire avec le nom d'un fichier �
     *        importer.
     *
     * @param[in] filename      nom d'un fichier � importer
     */
-    DictionaryTree(const std::string &filename);
+    BasicDictionaryTree(const std::string &filename);
 
     /**
-    * @fn ~DictionaryTree()
+    * @fn BasicDictionaryTree(const std::string& filename,
+    *                         std::vector<std::string>& words)
+    * @brief Constructeur d'un dictionnaire avec le nom de son fichier et ses
+    *        mots déjà lus et nettoyés.
+    *
+    * @param[in] filename      nom du fichier du dictionnaire
+    * @param[in] words         mots du dictionnaire, triés par la méthode
+    */
+    BasicDictionaryTree(const std::string &filename, std::vector<std::string> &words);
+
+    /**
+    * @fn ~BasicDictionaryTree()
     * @brief Destructeur d'un dictionnaire, suppression du contenu du
     *        dictionnaire.
     */
-    ~DictionaryTree();
+    ~BasicDictionaryTree();
 
     /**
     * @fn void add(const std::string& word)
@@ -82,11 +97,111 @@ public:
     */
     size_t size() const;
 
+    /**
+    * @fn size_t height() const
+    * @brief Obtient la hauteur de l'arbre du dictionnaire.
+    *
+    * @return hauteur de l'arbre.
+    */
+    size_t height() const;
+
+    /**
+    * @fn size_t nodeCount() const
+    * @brief Obtient le nombre de noeuds de l'arbre du dictionnaire.
+    *
+    * @return nombre de noeuds de l'arbre.
+    */
+    size_t nodeCount() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par l'arbre du dictionnaire.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+    /**
+    * @fn bool save(const std::string& filename) const
+    * @brief Ecris l'image binaire de l'arbre du dictionnaire, lisible par
+    *        DictionaryMapped. L'image note la taille et la date du fichier
+    *        du dictionnaire.
+    *
+    * @param[in] filename      nom du fichier à écrire
+    *
+    * @return true si le fichier a été écrit, false sinon.
+    */
+    bool save(const std::string &filename) const;
+
+    /**
+    * @fn void suggest(const std::string& word,
+    *                  std::vector<Correction>& corrections) const
+    * @brief Ajoute les corrections du mot à distance d'édition 1, dans
+    *        l'ordre de Correction, en un seul parcours de l'arbre : le
+    *        préfixe commun aux corrections d'une position est suivi une fois,
+    *        et les lettres ajoutées ou remplacées ne sont essayées que parmi
+    *        les noeuds existants. Produit les mêmes corrections que la
+    *        génération lettre par lettre.
+    *
+    * @param[in] word           mot mal orthographié, nettoyé
+    * @param[out] corrections   tableau auquel ajouter les corrections
+    */
+    void suggest(const std::string &word, std::vector<Correction> &corrections) const;
+
 private:
+    typedef typename TreeType::Handle Handle;
+
+    /**
+    * @fn Handle findChar(Handle level, char c) const
+    * @brief Obtient le noeud d'un caractère parmi les noeuds d'un niveau,
+    *        reliés par leurs sous-arbres gauche et droit.
+    *
+    * @return noeud du caractère, Handle() si il est absent.
+    */
+    Handle findChar(Handle level, char c) const;
+
+    /**
+    * @fn bool matchesFrom(Handle node, const std::string& word,
+    *                      size_t position) const
+    * @brief Indique si le chemin suivi jusqu'au noeud, complété par la fin
+    *        du mot à partir d'une position, est une clé de l'arbre.
+    */
+    bool matchesFrom(Handle node, const std::string &word, size_t position) const;
+
     /**
-    * @var   TernarySearchTree tree
+    * @fn template <typename Function>
+    *     void visitLevel(Handle level, Function function) const
+    * @brief Appelle la fonction sur chaque noeud d'un niveau.
+    */
+    template<typename Function>
+    void visitLevel(Handle level, Function function) const;
+
+    /**
+    * @fn void build(std::vector<std::string>& words)
+    * @brief Ajoute les mots au dictionnaire dans un ordre qui donne un arbre
+    *        équilibré : les mots sont triés, dédoublonnés, puis le médian de
+    *        chaque intervalle est ajouté avant les deux moitiés.
+    *
+    * @param[in] words     mots à ajouter, triés par la méthode
+    */
+    void build(std::vector<std::string> &words);
+
+    /**
+    * @var   TreeType tree
     * @brief Arbre ternaire de recherche pour stocker les mots du dictionnaire.
     */
-    TernarySearchTree<size_t> tree;
+    TreeType tree;
 };
 
+/**
+* @typedef BasicDictionaryTree<TernarySearchTree<size_t>> DictionaryTree
+* @brief Dictionnaire sur un arbre ternaire de recherche à pointeurs.
+*/
+typedef BasicDictionaryTree<TernarySearchTree<size_t>> DictionaryTree;
+
+/**
+* @typedef BasicDictionaryTree<FlatTernarySearchTree<size_t>> DictionaryFlatTree
+* @brief Dictionnaire sur un arbre ternaire de recherche à indices.
+*/
+typedef BasicDictionaryTree<FlatTernarySearchTree<size_t>> DictionaryFlatTree;
+
@@ -0,0 +1,152 @@
+/**
+*  @file EditDistance.cpp
+*  @brief Outils de calcul de la distance d'édition entre un mot et ses
+*         corrections.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <cstdint>
+
+#include "EditDistance.h"
+
+namespace {
+    /**
+    * @fn void addSingleEdits(const std::string& word,
+    *                         const std::string& candidate,
+    *                         std::vector<Correction>& corrections)
+    * @brief Ajoute chaque erreur unique du mot menant au candidat.
+    */
+    void addSingleEdits(const std::string &word, const std::string &candidate,
+                        std::vector<Correction> &corrections) {
+        const size_t LENGTH = word.length();
+        const size_t SIZE = candidate.length();
+        size_t common = 0;
+        size_t suffix = 0;
+
+        while (common < LENGTH && common < SIZE && word[common] == candidate[common])
+            ++common;
+
+        while (suffix < LENGTH && suffix < SIZE
+               && word[LENGTH - 1 - suffix] == candidate[SIZE - 1 - suffix])
+            ++suffix;
+
+        if (SIZE + 1 == LENGTH) {
+            // Lettre en trop : word privé de word[i] vaut candidate.
+            for (size_t i = LENGTH - 1 - std::min(suffix, LENGTH - 1); i <= common; ++i)
+                corrections.push_back(Correction{1, i, 0, candidate});
+        } else if (SIZE == LENGTH + 1) {
+            // Lettre manquante : candidate privé de candidate[i] vaut word.
+            for (size_t i = SIZE - 1 - std::min(suffix, SIZE - 1); i <= common; ++i)
+                if (isLetter(candidate[i]))
+                    corrections.push_back(Correction{2, i, candidate[i], candidate});
+        } else if (common + 1 + suffix >= LENGTH) {
+            // Lettre erronée
+            if (isLetter(candidate[common]))
+                corrections.push_back(Correction{3, common, candidate[common],
+                                                 candidate});
+        } else {
+            // Lettres inversées
+            corrections.push_back(Correction{4, common, 0, candidate});
+        }
+    }
+}
+
+bool addCorrections(const std::string &word, const std::string &candidate,
+                    size_t maxDistance, std::vector<Correction> &corrections) {
+    const size_t LENGTH = word.length();
+    const size_t SIZE = candidate.length();
+    const size_t COLUMNS = LENGTH + 1;
+
+    if (std::max(LENGTH, SIZE) - std::min(LENGTH, SIZE) > maxDistance)
+        return false;
+
+    // Les distances sont bornées à LIMIT ; ajouter ou remplacer un caractère
+    // qui n'est pas une lettre coûte LIMIT, ce qui l'exclut de la correction.
+    const uint32_t LIMIT = (uint32_t) maxDistance + 1;
+
+    // distances[i * COLUMNS + j] : distance entre candidate[0, i) et
+    // word[0, j)
+    std::vector<uint32_t> distances((SIZE + 1) * COLUMNS);
+    auto at = [&](size_t i, size_t j) -> uint32_t & {
+        return distances[i * COLUMNS + j];
+    };
+
+    for (size_t j = 0; j <= LENGTH; ++j)
+        at(0, j) = (uint32_t) std::min<size_t>(j, LIMIT);
+
+    for (size_t i = 1; i <= SIZE; ++i) {
+        const char c = candidate[i - 1];
+        const uint32_t EDIT = isLetter(c) ? 1 : LIMIT;
+
+        at(i, 0) = std::min(at(i - 1, 0) + EDIT, LIMIT);
+
+        for (size_t j = 1; j <= LENGTH; ++j) {
+            uint32_t cost = std::min(at(i - 1, j - 1) + (word[j - 1] == c ? 0 : EDIT),
+                                     std::min(at(i - 1, j) + EDIT, at(i, j - 1) + 1));
+
+            // Inversion des deux dernières lettres
+            if (i > 1 && j > 1 && word[j - 2] == c && word[j - 1] == candidate[i - 2])
+                cost = std::min(cost, at(i - 2, j - 2) + 1);
+
+            at(i, j) = std::min(cost, LIMIT);
+        }
+    }
+
+    const uint32_t DISTANCE = at(SIZE, LENGTH);
+
+    // Le mot lui-même n'est pas une correction.
+    if (DISTANCE == 0 || DISTANCE > maxDistance)
+        return false;
+
+    if (DISTANCE == 1) {
+        addSingleEdits(word, candidate, corrections);
+        return true;
+    }
+
+    Correction correction{0, 0, 0, candidate};
+    correction.distance = DISTANCE;
+
+    // Remonte un alignement de distance minimale depuis la fin des deux
+    // mots. La dernière erreur rencontrée est la première du mot.
+    size_t i = SIZE;
+    size_t j = LENGTH;
+
+    while (i > 0 || j > 0) {
+        const uint32_t COST = at(i, j);
+        const char c = i ? candidate[i - 1] : 0;
+        const uint32_t EDIT = isLetter(c) ? 1 : LIMIT;
+
+        if (i && j && word[j - 1] == c && at(i - 1, j - 1) == COST) {
+            --i;
+            --j;
+        } else if (i && j && at(i - 1, j - 1) + EDIT == COST) {
+            correction.type = 3;
+            correction.position = --j;
+            correction.letter = c;
+            --i;
+        } else if (i > 1 && j > 1 && word[j - 2] == c && word[j - 1] == candidate[i - 2]
+                   && at(i - 2, j - 2) + 1 == COST) {
+            correction.type = 4;
+            correction.position = j - 2;
+            correction.letter = 0;
+            i -= 2;
+            j -= 2;
+        } else if (j && at(i, j - 1) + 1 == COST) {
+            correction.type = 1;
+            correction.position = --j;
+            correction.letter = 0;
+        } else {
+            correction.type = 2;
+            correction.position = j;
+            correction.letter = c;
+            --i;
+        }
+    }
+
+    corrections.push_back(std::move(correction));
+    return true;
+}
@@ -0,0 +1,58 @@
+/**
+*  @file EditDistance.h
+*  @brief Outils de calcul de la distance d'édition entre un mot et ses
+*         corrections.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "ISuggestionEngine.h"
+
+/**
+* La distance est celle de Damerau-Levenshtein restreinte (optimal string
+* alignment) : suppression, ajout, remplacement et inversion de deux lettres
+* voisines, les quatre types d'erreur du correcteur orthographique. Comme
+* pour les corrections générées, seules les lettres de 'a' à 'z' peuvent
+* être ajoutées ou remplacées.
+*/
+
+/**
+* @fn bool isLetter(char c)
+* @brief Indique si le caractère fait partie de l'alphabet essayé par le
+*        correcteur orthographique.
+*
+* @param[in] c    caractère à tester
+*
+* @return true si le caractère peut être ajouté ou remplacé, false sinon.
+*/
+inline bool isLetter(char c) {
+    return c >= 'a' && c <= 'z';
+}
+
+/**
+* @fn bool addCorrections(const std::string& word,
+*                         const std::string& candidate, size_t maxDistance,
+*                         std::vector<Correction>& corrections)
+* @brief Ajoute les corrections du mot menant au candidat, si le candidat
+*        est à distance maximale au plus. A distance 1, chaque position
+*        produisant le candidat est une correction, comme pour les
+*        corrections générées ; au-delà, le candidat n'est ajouté qu'une
+*        fois, avec le type, la position et la lettre de la première erreur
+*        d'un alignement de distance minimale.
+*
+* @param[in] word           mot mal orthographié
+* @param[in] candidate      mot du dictionnaire
+* @param[in] maxDistance    distance d'édition maximale
+* @param[out] corrections   tableau auquel ajouter les corrections
+*
+* @return true si des corrections ont été ajoutées, false sinon.
+*/
+bool addCorrections(const std::string &word, const std::string &candidate,
+                    size_t maxDistance, std::vector<Correction> &corrections);
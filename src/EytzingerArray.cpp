@@ -0,0 +1,148 @@
+/**
+*  @file EytzingerArray.cpp
+*  @brief Modélise un tableau trié de mots rangé dans l'ordre d'Eytzinger :
+*         l'ordre d'un parcours en largeur de l'arbre binaire de recherche
+*         équilibré des mots.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "EytzingerArray.h"
+
+EytzingerArray::EytzingerArray() {
+    clear();
+}
+
+void EytzingerArray::build(const std::vector<std::string> &words) {
+    clear();
+    count = words.size();
+    lines.assign(count / LINE_ENTRIES + 1, Line{});
+
+    // Le parcours symétrique de l'arbre implicite visite les positions dans
+    // l'ordre des mots.
+    size_t position = first();
+
+    for (const std::string &word : words) {
+        Entry &e = lines[position / LINE_ENTRIES].entries[position % LINE_ENTRIES];
+        e.prefix = prefixOf(word.data(), word.length());
+        e.offset = (uint32_t) letters.size();
+        e.length = (uint32_t) word.length();
+
+        letters += word;
+        position = next(position);
+    }
+
+    letters.shrink_to_fit();
+}
+
+void EytzingerArray::clear() {
+    std::vector<Line>().swap(lines);
+    std::string().swap(letters);
+    count = 0;
+}
+
+bool EytzingerArray::contains(const std::string &word) const {
+    const size_t position = lowerBound(word);
+    if (position == 0)
+        return false;
+
+    const Entry &e = entry(position);
+
+    return e.length == word.length()
+           && std::memcmp(letters.data() + e.offset, word.data(), e.length) == 0;
+}
+
+size_t EytzingerArray::lowerBound(const std::string &word) const {
+    const uint64_t prefix = prefixOf(word.data(), word.length());
+    size_t position = 1;
+
+    while (position <= count) {
+        // Les descendants 4 niveaux plus bas occupent les lignes 4k à 4k + 3 ;
+        // les deux premières sont chargées à l'avance.
+        __builtin_prefetch(lines.data() + 4 * position);
+        __builtin_prefetch(lines.data() + 4 * position + 1);
+
+        position = 2 * position + less(entry(position), prefix, word);
+    }
+
+    // Remonte jusqu'au dernier ancêtre dont la recherche est partie à gauche
+    return position >> __builtin_ffsll((long long) ~position);
+}
+
+size_t EytzingerArray::first() const {
+    if (count == 0)
+        return 0;
+
+    size_t position = 1;
+    while (2 * position <= count)
+        position *= 2;
+
+    return position;
+}
+
+size_t EytzingerArray::next(size_t position) const {
+    // Le plus petit mot du sous-arbre droit
+    if (2 * position + 1 <= count) {
+        position = 2 * position + 1;
+        while (2 * position <= count)
+            position *= 2;
+
+        return position;
+    }
+
+    // Sinon le premier ancêtre dont le mot est dans le sous-arbre gauche
+    return position >> __builtin_ffsll((long long) ~position);
+}
+
+std::string EytzingerArray::word(size_t position) const {
+    const Entry &e = entry(position);
+    return std::string(letters.data() + e.offset, e.length);
+}
+
+size_t EytzingerArray::size() const {
+    return count;
+}
+
+size_t EytzingerArray::countLevels() const {
+    size_t levels = 0;
+    for (size_t n = count; n; n >>= 1)
+        ++levels;
+
+    return levels;
+}
+
+size_t EytzingerArray::memoryUsage() const {
+    return lines.capacity() * sizeof(Line) + letters.capacity();
+}
+
+bool EytzingerArray::less(const Entry &e, uint64_t prefix,
+                          const std::string &word) const {
+    if (e.prefix != prefix)
+        return e.prefix < prefix;
+
+    // Même début : les lettres suivantes, puis la longueur, départagent.
+    const size_t LENGTH = std::min<size_t>(e.length, word.length());
+    if (LENGTH > sizeof(prefix)) {
+        const int order = std::memcmp(letters.data() + e.offset + sizeof(prefix),
+                                      word.data() + sizeof(prefix),
+                                      LENGTH - sizeof(prefix));
+        if (order != 0)
+            return order < 0;
+    }
+
+    return e.length < word.length();
+}
+
+uint64_t EytzingerArray::prefixOf(const char *word, size_t length) {
+    uint64_t prefix = 0;
+
+    for (size_t i = 0; i < sizeof(prefix); ++i)
+        prefix = (prefix << 8) | (i < length ? (unsigned char) word[i] : 0);
+
+    return prefix;
+}
@@ -0,0 +1,185 @@
+/**
+*  @file EytzingerArray.h
+*  @brief Modélise un tableau trié de mots rangé dans l'ordre d'Eytzinger :
+*         l'ordre d'un parcours en largeur de l'arbre binaire de recherche
+*         équilibré des mots.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+* Les mots sont numérotés à partir de 1 : les enfants du mot k sont les mots
+* 2k et 2k + 1. Une recherche parcourt donc le tableau du début vers la fin
+* et les quatre petits-enfants d'un mot sont sur une même ligne de cache,
+* chargée à l'avance. Chaque entrée garde les 8 premiers octets du mot, la
+* plupart des comparaisons ne lisent donc pas les lettres.
+*
+* Une position est le numéro d'un mot, 0 désigne la fin du tableau.
+*/
+class EytzingerArray {
+public:
+    /**
+    * @fn EytzingerArray()
+    * @brief Constructeur d'un tableau vide.
+    */
+    EytzingerArray();
+
+    /**
+    * @fn void build(const std::vector<std::string>& words)
+    * @brief Construit le tableau des mots, en remplaçant le contenu actuel.
+    *
+    * @param[in] words     mots triés, sans doublon
+    */
+    void build(const std::vector<std::string> &words);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du tableau.
+    */
+    void clear();
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est dans le tableau.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est présent, false sinon.
+    */
+    bool contains(const std::string &word) const;
+
+    /**
+    * @fn size_t lowerBound(const std::string& word) const
+    * @brief Obtient la position du premier mot qui n'est pas avant le mot
+    *        donné. La recherche ne fait aucun branchement sur le résultat
+    *        des comparaisons.
+    *
+    * @param[in] word     mot recherché
+    *
+    * @return position du mot trouvé, 0 si tous les mots sont avant.
+    */
+    size_t lowerBound(const std::string &word) const;
+
+    /**
+    * @fn size_t first() const
+    * @brief Obtient la position du plus petit mot.
+    *
+    * @return position du mot, 0 si le tableau est vide.
+    */
+    size_t first() const;
+
+    /**
+    * @fn size_t next(size_t position) const
+    * @brief Obtient la position du mot suivant dans l'ordre alphabétique.
+    *
+    * @param[in] position   position d'un mot
+    *
+    * @return position du mot suivant, 0 après le dernier.
+    */
+    size_t next(size_t position) const;
+
+    /**
+    * @fn std::string word(size_t position) const
+    * @brief Obtient le mot d'une position.
+    *
+    * @param[in] position   position d'un mot
+    *
+    * @return mot de la position.
+    */
+    std::string word(size_t position) const;
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots du tableau.
+    *
+    * @return nombre de mots.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t countLevels() const
+    * @brief Obtient le nombre de niveaux de l'arbre implicite, le nombre
+    *        maximal de comparaisons d'une recherche.
+    *
+    * @return nombre de niveaux.
+    */
+    size_t countLevels() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les entrées et les lettres.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @var   struct Entry
+    * @brief Mot du tableau.
+    */
+    struct Entry {
+        uint64_t prefix;    // 8 premiers octets, complétés par des zéros
+        uint32_t offset;    // position des lettres dans letters
+        uint32_t length;    // longueur du mot
+    };
+
+    // Nombre d'entrées par ligne de cache
+    static constexpr size_t LINE_ENTRIES = 4;
+
+    /**
+    * @var   struct Line
+    * @brief Entrées d'une ligne de cache.
+    */
+    struct alignas(64) Line {
+        Entry entries[LINE_ENTRIES];
+    };
+
+    /**
+    * @fn const Entry& entry(size_t position) const
+    * @brief Obtient l'entrée d'une position.
+    */
+    const Entry &entry(size_t position) const {
+        return lines[position / LINE_ENTRIES].entries[position % LINE_ENTRIES];
+    }
+
+    /**
+    * @fn bool less(const Entry& entry, uint64_t prefix,
+    *               const std::string& word) const
+    * @brief Indique si le mot d'une entrée est avant le mot donné.
+    */
+    bool less(const Entry &entry, uint64_t prefix, const std::string &word) const;
+
+    /**
+    * @fn static uint64_t prefixOf(const char* word, size_t length)
+    * @brief Obtient les 8 premiers octets du mot, dans un entier dont l'ordre
+    *        est celui des mots.
+    */
+    static uint64_t prefixOf(const char *word, size_t length);
+
+    /**
+    * @var   std::vector<Line> lines
+    * @brief Entrées dans l'ordre d'Eytzinger, la position 0 est inutilisée.
+    */
+    std::vector<Line> lines;
+
+    /**
+    * @var   std::string letters
+    * @brief Lettres des mots à la suite, dans l'ordre alphabétique.
+    */
+    std::string letters;
+
+    /**
+    * @var   size_t count
+    * @brief Nombre de mots du tableau.
+    */
+    size_t count;
+};
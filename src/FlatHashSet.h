@@ -0,0 +1,423 @@
+/**
+*  @file FlatHashSet.h
+*  @brief Modélise un ensemble de mots dans une table de hachage à adressage
+*         ouvert, sondée par groupes de 16 cases (à la manière des
+*         Swiss tables).
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "Hash.h"
+
+/**
+* Chaque case a un octet de contrôle : EMPTY, DELETED ou les 7 bits de poids
+* faible de l'empreinte du mot qu'elle contient. Une recherche compare les 16
+* octets de contrôle d'un groupe en une instruction et ne lit les mots que des
+* cases dont les 7 bits correspondent. Elle s'arrête au premier groupe
+* contenant une case EMPTY, un mot absent coûte donc en général la lecture
+* d'un seul groupe d'octets de contrôle.
+*
+* Les mots sont stockés à la suite dans un seul tableau de caractères, les
+* cases ne contiennent que leur position et leur longueur.
+*/
+class FlatHashSet {
+public:
+    /**
+    * @fn FlatHashSet()
+    * @brief Constructeur d'un ensemble vide.
+    */
+    FlatHashSet() {
+        clear();
+    }
+
+    /**
+    * @fn void clear()
+    * @brief Supprime tous les mots et rend la mémoire.
+    */
+    void clear() {
+        std::vector<int8_t>().swap(controls);
+        std::vector<Slot>().swap(slots);
+        std::string().swap(letters);
+        count = 0;
+        tombstones = 0;
+        groupMask = 0;
+    }
+
+    /**
+    * @fn void reserve(size_t words)
+    * @brief Dimensionne la table pour contenir le nombre de mots sans
+    *        l'agrandir.
+    *
+    * @param[in] words     nombre de mots prévus
+    */
+    void reserve(size_t words) {
+        size_t capacity = GROUP_SIZE;
+        while (capacity * MAX_LOAD_NUM < words * MAX_LOAD_DEN)
+            capacity *= 2;
+
+        if (capacity > slots.size())
+            rehash(capacity);
+    }
+
+    /**
+    * @fn bool insert(const std::string& word)
+    * @brief Ajoute un mot à l'ensemble, s'il n'y est pas présent.
+    *
+    * @param[in] word      mot à ajouter
+    *
+    * @return true si le mot a été ajouté, false s'il était déjà présent.
+    */
+    bool insert(const std::string &word) {
+        const uint64_t hash = hashWord(word.data(), word.length());
+
+        if (find(word.data(), word.length(), hash) != NOT_FOUND)
+            return false;
+
+        if ((count + tombstones + 1) * MAX_LOAD_DEN > slots.size() * MAX_LOAD_NUM)
+            grow();
+
+        const size_t slot = freeSlot(hash);
+        if (controls[slot] == DELETED)
+            --tombstones;
+
+        controls[slot] = (int8_t) (hash & 0x7f);
+        slots[slot] = Slot{(uint32_t) letters.size(), (uint32_t) word.length()};
+        letters += word;
+        ++count;
+
+        return true;
+    }
+
+    /**
+    * @fn size_t erase(const std::string& word)
+    * @brief Supprime un mot de l'ensemble. Sa case devient DELETED pour ne
+    *        pas interrompre les recherches des autres mots.
+    *
+    * @param[in] word      mot à supprimer
+    *
+    * @return nombre de mots supprimés.
+    */
+    size_t erase(const std::string &word) {
+        const size_t slot = find(word.data(), word.length(),
+                                 hashWord(word.data(), word.length()));
+        if (slot == NOT_FOUND)
+            return 0;
+
+        controls[slot] = DELETED;
+        --count;
+        ++tombstones;
+
+        return 1;
+    }
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est dans l'ensemble.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est présent, false sinon.
+    */
+    bool contains(const std::string &word) const {
+        return count && find(word.data(), word.length(),
+                             hashWord(word.data(), word.length())) != NOT_FOUND;
+    }
+
+    /**
+    * @fn template <typename Equal>
+    *     bool contains(uint64_t hash, Equal equal) const
+    * @brief Indique si un mot, connu par son empreinte, est dans l'ensemble.
+    *        Le mot n'est comparé qu'aux mots des cases de même octet de
+    *        contrôle.
+    *
+    * @param[in] hash      hashWord() du mot recherché
+    * @param[in] equal     equal(data, length) indique si le mot est égal aux
+    *                      caractères d'une case
+    *
+    * @return true si le mot est présent, false sinon.
+    */
+    template<typename Equal>
+    bool contains(uint64_t hash, Equal equal) const {
+        return count && find(hash, equal) != NOT_FOUND;
+    }
+
+    /**
+    * @fn void prefetch(uint64_t hash) const
+    * @brief Lance le chargement du premier groupe d'octets de contrôle d'une
+    *        empreinte, lu par la recherche du mot.
+    *
+    * @param[in] hash      hashWord() du mot qui sera recherché
+    */
+    void prefetch(uint64_t hash) const {
+        if (!slots.empty()) {
+            const size_t GROUP = (size_t) (hash >> 7) & groupMask;
+            __builtin_prefetch(controls.data() + GROUP * GROUP_SIZE);
+        }
+    }
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots de l'ensemble.
+    *
+    * @return nombre de mots.
+    */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+    * @fn size_t capacity() const
+    * @brief Obtient le nombre de cases de la table.
+    *
+    * @return nombre de cases.
+    */
+    size_t capacity() const {
+        return slots.size();
+    }
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par la table et les mots.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const {
+        return controls.capacity() * sizeof(int8_t)
+               + slots.capacity() * sizeof(Slot)
+               + letters.capacity();
+    }
+
+private:
+    /**
+    * @var   struct Slot
+    * @brief Position et longueur d'un mot dans letters.
+    */
+    struct Slot {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    // Nombre de cases d'un groupe, comparées ensemble
+    static constexpr size_t GROUP_SIZE = 16;
+
+    // Taux de remplissage maximal, cases DELETED comprises : 7/8
+    static constexpr size_t MAX_LOAD_NUM = 7;
+    static constexpr size_t MAX_LOAD_DEN = 8;
+
+    // Octets de contrôle des cases sans mot
+    static constexpr int8_t EMPTY = -128;
+    static constexpr int8_t DELETED = -2;
+
+    // Position retournée pour un mot absent
+    static constexpr size_t NOT_FOUND = SIZE_MAX;
+
+    /**
+    * @var   std::vector<int8_t> controls
+    * @brief Octet de contrôle de chaque case.
+    */
+    std::vector<int8_t> controls;
+
+    /**
+    * @var   std::vector<Slot> slots
+    * @brief Mot de chaque case.
+    */
+    std::vector<Slot> slots;
+
+    /**
+    * @var   std::string letters
+    * @brief Lettres de tous les mots ajoutés, à la suite.
+    */
+    std::string letters;
+
+    /**
+    * @var   size_t count
+    * @brief Nombre de mots de l'ensemble.
+    */
+    size_t count;
+
+    /**
+    * @var   size_t tombstones
+    * @brief Nombre de cases DELETED.
+    */
+    size_t tombstones;
+
+    /**
+    * @var   size_t groupMask
+    * @brief Nombre de groupes moins 1, le nombre de groupes étant une
+    *        puissance de 2.
+    */
+    size_t groupMask;
+
+    /**
+    * @fn static uint32_t match(const int8_t* group, int8_t value)
+    * @brief Compare les octets de contrôle d'un groupe à une valeur.
+    *
+    * @param[in] group   premier octet de contrôle du groupe
+    * @param[in] value   valeur recherchée
+    *
+    * @return masque dont le bit i est à 1 si la case i du groupe a la valeur.
+    */
+    static uint32_t match(const int8_t *group, int8_t value) {
+#ifdef __SSE2__
+        const __m128i controls = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+        return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8(value)));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP_SIZE; ++i)
+            mask |= (uint32_t) (group[i] == value) << i;
+
+        return mask;
+#endif
+    }
+
+    /**
+    * @fn static uint32_t matchFree(const int8_t* group)
+    * @brief Indique les cases EMPTY ou DELETED d'un groupe : ce sont les
+    *        seules dont le bit de poids fort est à 1.
+    *
+    * @param[in] group   premier octet de contrôle du groupe
+    *
+    * @return masque dont le bit i est à 1 si la case i du groupe est libre.
+    */
+    static uint32_t matchFree(const int8_t *group) {
+#ifdef __SSE2__
+        return (uint32_t) _mm_movemask_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(group)));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP_SIZE; ++i)
+            mask |= (uint32_t) (group[i] < 0) << i;
+
+        return mask;
+#endif
+    }
+
+    /**
+    * @fn template <typename Equal>
+    *     size_t find(uint64_t hash, Equal equal) const
+    * @brief Obtient la case d'un mot. Les groupes sont sondés dans l'ordre
+    *        triangulaire, qui les visite tous.
+    *
+    * @return position de la case, NOT_FOUND si le mot est absent.
+    */
+    template<typename Equal>
+    size_t find(uint64_t hash, Equal equal) const {
+        if (slots.empty())
+            return NOT_FOUND;
+
+        const int8_t TAG = (int8_t) (hash & 0x7f);
+        size_t group = (size_t) (hash >> 7) & groupMask;
+
+        for (size_t probe = 1;; ++probe) {
+            const size_t FIRST = group * GROUP_SIZE;
+            const int8_t *control = controls.data() + FIRST;
+
+            for (uint32_t mask = match(control, TAG); mask; mask &= mask - 1) {
+                const size_t slot = FIRST + (size_t) __builtin_ctz(mask);
+                const Slot &candidate = slots[slot];
+
+                if (equal(letters.data() + candidate.offset, (size_t) candidate.length))
+                    return slot;
+            }
+
+            if (match(control, EMPTY))
+                return NOT_FOUND;
+
+            group = (group + probe) & groupMask;
+        }
+    }
+
+    /**
+    * @fn size_t find(const char* word, size_t length, uint64_t hash) const
+    * @brief Obtient la case d'un mot.
+    *
+    * @return position de la case, NOT_FOUND si le mot est absent.
+    */
+    size_t find(const char *word, size_t length, uint64_t hash) const {
+        return find(hash, [word, length](const char *data, size_t size) {
+            return size == length && std::memcmp(data, word, length) == 0;
+        });
+    }
+
+    /**
+    * @fn size_t freeSlot(uint64_t hash) const
+    * @brief Obtient la première case libre de la suite de groupes d'une
+    *        empreinte. La table ne doit pas être pleine.
+    *
+    * @return position de la case.
+    */
+    size_t freeSlot(uint64_t hash) const {
+        size_t group = (size_t) (hash >> 7) & groupMask;
+
+        for (size_t probe = 1;; ++probe) {
+            const size_t FIRST = group * GROUP_SIZE;
+            const uint32_t mask = matchFree(controls.data() + FIRST);
+
+            if (mask)
+                return FIRST + (size_t) __builtin_ctz(mask);
+
+            group = (group + probe) & groupMask;
+        }
+    }
+
+    /**
+    * @fn void grow()
+    * @brief Double la taille de la table, ou la reconstruit à la même taille
+    *        si elle est surtout encombrée de cases DELETED.
+    */
+    void grow() {
+        if (slots.empty())
+            rehash(GROUP_SIZE);
+        else if ((count + 1) * 2 * MAX_LOAD_DEN > slots.size() * MAX_LOAD_NUM)
+            rehash(slots.size() * 2);
+        else
+            rehash(slots.size());
+    }
+
+    /**
+    * @fn void rehash(size_t capacity)
+    * @brief Reconstruit la table avec le nombre de cases donné. Les lettres
+    *        des mots supprimés sont oubliées au passage.
+    *
+    * @param[in] capacity   nombre de cases, multiple de 16 et puissance de 2
+    */
+    void rehash(size_t capacity) {
+        std::vector<int8_t> oldControls(capacity, EMPTY);
+        std::vector<Slot> oldSlots(capacity);
+        std::string oldLetters;
+
+        oldControls.swap(controls);
+        oldSlots.swap(slots);
+        oldLetters.swap(letters);
+
+        letters.reserve(oldLetters.size());
+        groupMask = capacity / GROUP_SIZE - 1;
+        tombstones = 0;
+
+        for (size_t i = 0; i < oldSlots.size(); ++i) {
+            if (oldControls[i] < 0)
+                continue;
+
+            const Slot &old = oldSlots[i];
+            const char *word = oldLetters.data() + old.offset;
+            const size_t slot = freeSlot(hashWord(word, old.length));
+
+            controls[slot] = oldControls[i];
+            slots[slot] = Slot{(uint32_t) letters.size(), old.length};
+            letters.append(word, old.length);
+        }
+    }
+};
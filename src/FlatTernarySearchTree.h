@@ -0,0 +1,607 @@
+/**
+*  @file FlatTernarySearchTree.h
+*  @brief Modélise un arbre ternaire de recherche dont les noeuds sont rangés
+*         dans des tableaux contigus et reliés par des indices 32 bits.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+template<typename ValueType>
+class FlatTernarySearchTree {
+public:
+    /**
+    * @typedef uint32_t Handle
+    * @brief Indice d'un noeud de l'arbre. Handle() désigne un sous-arbre
+    *        vide.
+    */
+    typedef uint32_t Handle;
+
+    /**
+    * @fn FlatTernarySearchTree()
+    * @brief Constructeur d'un arbre ternaire de recherche vide.
+    */
+    FlatTernarySearchTree() {
+        clear();
+    }
+
+    /**
+    * @fn std::vector<std::string>& allKeys(std::vector<std::string>& keys) const
+    * @brief Obtient toutes les clés de l'arbre ternaire de recherche.
+    *
+    * @param[in] keys      tableau de toutes les clés de l'arbre ternaire de
+    *                      recherche.
+    * @return tableau contenant toutes les clés de l'arbre ternaire de
+    *         recherche.
+    */
+    std::vector<std::string> &allKeys(std::vector<std::string> &keys) const {
+        collect(keys);
+        return keys;
+    }
+
+    /**
+    * @fn std::vector<std::string> allKeys() const
+    * @brief Obtient toutes les clés de l'arbre ternaire de recherche.
+    *
+    * @return tableau contenant toutes les clés de l'arbre ternaire de
+    *         recherche.
+    */
+    std::vector<std::string> allKeys() const {
+        std::vector<std::string> keys;
+        return allKeys(keys);
+    }
+
+    /**
+    * @fn bool contains(const std::string& key) const
+    * @brief Indique si la clé recherchée est contenue dans l'arbre ternaire
+    *        de recherche.
+    *
+    * @param[in] key     clé à rechercher
+    *
+    * @return true si la clé est contenue dans l'arbre ternaire de recherche,
+    *         false sinon
+    */
+    bool contains(const std::string &key) const {
+        return get(key) != (ValueType) NULL;
+    }
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu de l'arbre ternaire de recherche et rend la
+    *        mémoire des tableaux.
+    */
+    void clear() {
+        // L'indice 0 est réservé pour représenter l'absence de noeud.
+        std::vector<char>(1).swap(chars);
+        std::vector<ValueType>(1).swap(values);
+        std::vector<Links>(1).swap(links);
+        std::vector<uint32_t>().swap(freeNodes);
+        root = NIL;
+        keys = 0;
+    }
+
+    /**
+    * @fn size_t countKeys() const
+    * @brief Obtient le nombre de clés contenues dans l'arbre ternaire de
+    *        recherche, tenu à jour par put et remove.
+    *
+    * @return nombre de clés contenues dans l'arbre ternaire de recherche.
+    */
+    size_t countKeys() const {
+        return keys;
+    }
+
+    /**
+    * @fn size_t countNodes() const
+    * @brief Obtient le nombre de noeuds de l'arbre ternaire de recherche.
+    *
+    * @return nombre de noeuds de l'arbre ternaire de recherche.
+    */
+    size_t countNodes() const {
+        return chars.size() - 1 - freeNodes.size();
+    }
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les tableaux de l'arbre.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const {
+        return chars.capacity() * sizeof(char)
+               + values.capacity() * sizeof(ValueType)
+               + links.capacity() * sizeof(Links)
+               + freeNodes.capacity() * sizeof(uint32_t);
+    }
+
+    /**
+    * @fn ValueType get(const std::string& key) const
+    * @brief Obtient la valeur d'un clé de l'arbre ternaire de recherche.
+    *
+    * @param[in] key     clé de la valeur recherché
+    *
+    * @return valeur de la clé de l'arbre ternaire de recherche.
+    */
+    ValueType get(const std::string &key) const {
+        if (key.empty())
+            return (ValueType) NULL;
+
+        return values[find(key)];
+    }
+
+    /**
+    * @fn Handle getRoot() const
+    * @brief Obtient la racine de l'arbre ternaire de recherche.
+    *
+    * @return racine de l'arbre, Handle() si l'arbre est vide.
+    */
+    Handle getRoot() const {
+        return root;
+    }
+
+    /**
+    * @fn Handle getLeft(Handle node) const
+    * @brief Obtient le sous-arbre des caractères plus petits du noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return sous-arbre gauche du noeud.
+    */
+    Handle getLeft(Handle node) const {
+        return links[node].child[LEFT];
+    }
+
+    /**
+    * @fn Handle getMiddle(Handle node) const
+    * @brief Obtient le sous-arbre des caractères suivant celui du noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return sous-arbre central du noeud.
+    */
+    Handle getMiddle(Handle node) const {
+        return links[node].child[MIDDLE];
+    }
+
+    /**
+    * @fn Handle getRight(Handle node) const
+    * @brief Obtient le sous-arbre des caractères plus grands du noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return sous-arbre droit du noeud.
+    */
+    Handle getRight(Handle node) const {
+        return links[node].child[RIGHT];
+    }
+
+    /**
+    * @fn char getChar(Handle node) const
+    * @brief Obtient le caractère du noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return caractère du noeud.
+    */
+    char getChar(Handle node) const {
+        return chars[node];
+    }
+
+    /**
+    * @fn ValueType getValue(Handle node) const
+    * @brief Obtient la valeur du noeud, (ValueType) NULL si aucune clé ne
+    *        se termine sur ce noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return valeur du noeud.
+    */
+    ValueType getValue(Handle node) const {
+        return values[node];
+    }
+
+    /**
+    * @fn size_t height() const
+    * @brief Obtient la hauteur de l'arbre ternaire de recherche.
+    *
+    * @return hauteur de l'arbre ternaire de recherche.
+    */
+    size_t height() const {
+        size_t maxLevel = 0;
+        std::vector<std::pair<uint32_t, size_t>> stack;
+
+        if (root != NIL)
+            stack.emplace_back(root, 1);
+
+        while (!stack.empty()) {
+            uint32_t node = stack.back().first;
+            size_t level = stack.back().second;
+            stack.pop_back();
+
+            maxLevel = std::max(maxLevel, level);
+
+            for (uint32_t child : links[node].child)
+                if (child != NIL)
+                    stack.emplace_back(child, level + 1);
+        }
+
+        return maxLevel;
+    }
+
+    /**
+    * @fn void put(const std::string& key, const ValueType& value)
+    * @brief Ajoute une clé et une valeur à l'arbre ternaire de recherche.
+    */
+    void put(const std::string &key, const ValueType &value) {
+        if (key.empty())
+            return;
+
+        const char *k = key.data();
+        const size_t LAST = key.length() - 1;
+
+        uint32_t parent = NIL;
+        int direction = MIDDLE;
+        uint32_t node = root;
+        size_t charIndex = 0;
+
+        while (true) {
+            const char c = k[charIndex];
+
+            if (node == NIL) {
+                node = newNode(c);
+
+                if (parent == NIL)
+                    root = node;
+                else
+                    links[parent].child[direction] = node;
+            }
+
+            const char nodeChar = chars[node];
+
+            if (c < nodeChar)
+                direction = LEFT;
+            else if (c > nodeChar)
+                direction = RIGHT;
+            else if (charIndex < LAST) {
+                direction = MIDDLE;
+                ++charIndex;
+            } else {
+                if (!values[node] && value)
+                    ++keys;
+                else if (values[node] && !value)
+                    --keys;
+
+                values[node] = value;
+                return;
+            }
+
+            parent = node;
+            node = links[node].child[direction];
+        }
+    }
+
+    /**
+    * @fn size_t remove(const std::string& key)
+    * @brief Supprime la clé de l'arbre ternaire de recherche. Seuls les
+    *        noeuds du chemin de la clé devenus inutiles sont libérés.
+    *
+    * @return nombre de clés supprimées.
+    */
+    size_t remove(const std::string &key) {
+        if (key.empty())
+            return 0;
+
+        const char *k = key.data();
+        const size_t LAST = key.length() - 1;
+        size_t charIndex = 0;
+
+        // Noeuds suivis depuis la racine, chacun avec son parent et le
+        // sous-arbre du parent qui le contient
+        std::vector<Step> path;
+        uint32_t parent = NIL;
+        int direction = MIDDLE;
+        uint32_t node = root;
+
+        while (node != NIL) {
+            const char c = k[charIndex];
+            const char nodeChar = chars[node];
+            path.push_back(Step{node, parent, direction});
+
+            if (c < nodeChar)
+                direction = LEFT;
+            else if (c > nodeChar)
+                direction = RIGHT;
+            else if (charIndex < LAST) {
+                direction = MIDDLE;
+                ++charIndex;
+            } else {
+                if (!values[node])
+                    return 0;
+
+                values[node] = (ValueType) NULL;
+                --keys;
+                prune(path);
+
+                return 1;
+            }
+
+            parent = node;
+            node = links[node].child[direction];
+        }
+
+        return 0;
+    }
+
+    /**
+    * @fn template <typename Function>
+    *     void visitInOrder(Function f)
+    * @brief Permet de visiter l'arbre ternaire de recherche dans l'ordre
+    *        symétrique.
+    */
+    template<typename Function>
+    void visitInOrder(Function f) {
+        visit([&](uint32_t node) {
+            f(chars[node], values[node]);
+        });
+    }
+
+private:
+    /**
+    * @var   struct Links
+    * @brief Indices des sous-arbres gauche, central et droit d'un noeud.
+    */
+    struct Links {
+        uint32_t child[3];
+    };
+
+    // Position des sous-arbres dans Links::child
+    static constexpr int LEFT = 0;   // sous-arbre avec des clés plus petites
+    static constexpr int MIDDLE = 1; // sous-arbre avec des clés égales
+    static constexpr int RIGHT = 2;  // sous-arbre avec des clés plus grandes
+
+    // Indice représentant l'absence de noeud
+    static constexpr uint32_t NIL = 0;
+
+    /**
+    * @var   struct Step
+    * @brief Noeud du chemin d'une clé, avec le lien de son parent.
+    */
+    struct Step {
+        uint32_t node;
+        uint32_t parent;    // NIL pour la racine
+        int direction;      // sous-arbre du parent contenant le noeud
+    };
+
+    /**
+    * @var   std::vector<char> chars
+    * @brief Caractère de chaque noeud, séparé du reste pour que la
+    *        comparaison ne charge que les octets utiles.
+    */
+    std::vector<char> chars;
+
+    /**
+    * @var   std::vector<ValueType> values
+    * @brief Valeur de chaque noeud.
+    */
+    std::vector<ValueType> values;
+
+    /**
+    * @var   std::vector<Links> links
+    * @brief Liens de chaque noeud vers ses sous-arbres.
+    */
+    std::vector<Links> links;
+
+    /**
+    * @var   std::vector<uint32_t> freeNodes
+    * @brief Indices des noeuds supprimés, réutilisés par les ajouts.
+    */
+    std::vector<uint32_t> freeNodes;
+
+    /**
+    * @var   uint32_t root
+    * @brief Indice de la racine de l'arbre.
+    */
+    uint32_t root;
+
+    /**
+    * @var   size_t keys
+    * @brief Nombre de clés de l'arbre.
+    */
+    size_t keys;
+
+    /**
+    * @fn uint32_t newNode(char c)
+    * @brief Crée un noeud sans valeur ni enfant.
+    *
+    * @param[in] c       caractère du noeud
+    *
+    * @return indice du noeud créé.
+    */
+    uint32_t newNode(char c) {
+        if (!freeNodes.empty()) {
+            uint32_t node = freeNodes.back();
+            freeNodes.pop_back();
+            chars[node] = c;
+            return node;
+        }
+
+        chars.push_back(c);
+        values.push_back((ValueType) NULL);
+        links.push_back(Links{{NIL, NIL, NIL}});
+
+        return (uint32_t) (chars.size() - 1);
+    }
+
+    /**
+    * @fn uint32_t find(const std::string& key) const
+    * @brief Obtient le noeud du dernier caractère de la clé. La clé ne doit
+    *        pas être vide.
+    *
+    * @param[in] key     clé du noeud recherché
+    *
+    * @return indice du noeud recherché, NIL s'il n'existe pas.
+    */
+    uint32_t find(const std::string &key) const {
+        const char *k = key.data();
+        const size_t LAST = key.length() - 1;
+
+        uint32_t node = root;
+        size_t charIndex = 0;
+
+        while (node != NIL) {
+            const char c = k[charIndex];
+            const char nodeChar = chars[node];
+
+            if (c < nodeChar)
+                node = links[node].child[LEFT];
+            else if (c > nodeChar)
+                node = links[node].child[RIGHT];
+            else if (charIndex < LAST) {
+                node = links[node].child[MIDDLE];
+                ++charIndex;
+            } else
+                return node;
+        }
+
+        return NIL;
+    }
+
+    /**
+    * @fn void collect(std::vector<std::string>& keys) const
+    * @brief Rempli le tableau de toutes clés contenues dans l'arbre ternaire
+    *        de recherche, dans le même ordre que TernarySearchTree.
+    */
+    void collect(std::vector<std::string> &keys) const {
+        struct Frame {
+            uint32_t node;
+            size_t depth;
+            int stage;
+        };
+
+        std::string prefix;
+        std::vector<Frame> stack;
+
+        if (root != NIL)
+            stack.push_back(Frame{root, 0, LEFT});
+
+        while (!stack.empty()) {
+            Frame &frame = stack.back();
+            const uint32_t node = frame.node;
+            const size_t depth = frame.depth;
+
+            // Sous-arbres gauche, central puis droit, et enfin le noeud
+            if (frame.stage <= RIGHT) {
+                const int stage = frame.stage++;
+                const uint32_t child = links[node].child[stage];
+
+                if (child == NIL)
+                    continue;
+
+                if (stage == MIDDLE) {
+                    prefix.resize(depth);
+                    prefix.push_back(chars[node]);
+                    stack.push_back(Frame{child, depth + 1, LEFT});
+                } else
+                    stack.push_back(Frame{child, depth, LEFT});
+            } else {
+                if (values[node] && depth) {
+                    prefix.resize(depth);
+                    keys.push_back(prefix + chars[node]);
+                }
+
+                stack.pop_back();
+            }
+        }
+    }
+
+    /**
+    * @fn void prune(const std::vector<Step>& path)
+    * @brief Libère, du bas vers le haut, les noeuds du chemin qui ne portent
+    *        plus ni valeur ni sous-arbre central. Un noeud libéré est
+    *        remplacé par ses sous-arbres gauche et droit.
+    *
+    * @param[in] path    noeuds de la racine jusqu'au noeud d'une clé
+    */
+    void prune(const std::vector<Step> &path) {
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            const uint32_t node = it->node;
+
+            if (values[node] || links[node].child[MIDDLE] != NIL)
+                break;
+
+            const uint32_t replacement = detach(node);
+
+            if (it->parent == NIL)
+                root = replacement;
+            else
+                links[it->parent].child[it->direction] = replacement;
+
+            links[node] = Links{{NIL, NIL, NIL}};
+            freeNodes.push_back(node);
+        }
+    }
+
+    /**
+    * @fn uint32_t detach(uint32_t node)
+    * @brief Réunit les sous-arbres gauche et droit d'un noeud à retirer. Le
+    *        plus grand noeud du sous-arbre gauche prend sa place.
+    *
+    * @param[in] node    noeud à retirer
+    *
+    * @return racine du sous-arbre remplaçant le noeud.
+    */
+    uint32_t detach(uint32_t node) {
+        uint32_t *child = links[node].child;
+
+        if (child[LEFT] == NIL)
+            return child[RIGHT];
+
+        if (child[RIGHT] == NIL)
+            return child[LEFT];
+
+        uint32_t *link = &child[LEFT];
+        while (links[*link].child[RIGHT] != NIL)
+            link = &links[*link].child[RIGHT];
+
+        const uint32_t max = *link;
+        *link = links[max].child[LEFT];
+        links[max].child[LEFT] = child[LEFT];
+        links[max].child[RIGHT] = child[RIGHT];
+
+        return max;
+    }
+
+    /**
+    * @fn template <typename Function>
+    *     void visit(Function f) const
+    * @brief Applique la fonction à l'indice de chaque noeud, dans l'ordre
+    *        noeud, sous-arbre gauche, central puis droit.
+    */
+    template<typename Function>
+    void visit(Function f) const {
+        std::vector<uint32_t> stack;
+
+        if (root != NIL)
+            stack.push_back(root);
+
+        while (!stack.empty()) {
+            const uint32_t node = stack.back();
+            stack.pop_back();
+
+            f(node);
+
+            for (int i = RIGHT; i >= LEFT; --i)
+                if (links[node].child[i] != NIL)
+                    stack.push_back(links[node].child[i]);
+        }
+    }
+};
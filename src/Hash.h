@@ -0,0 +1,140 @@
+/**
+*  @file Hash.h
+*  @brief Fonctions de hachage rapides, non cryptographiques, des mots.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+* @fn inline uint64_t hashMix(uint64_t hash)
+* @brief Mélange les bits d'une valeur (finaliseur de MurmurHash3) : chaque
+*        bit du résultat dépend de tous les bits de la valeur.
+*
+* @param[in] hash    valeur à mélanger
+*
+* @return valeur mélangée.
+*/
+inline uint64_t hashMix(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+/**
+* @fn inline uint64_t hashBytes(const char* data, size_t length,
+*                              uint64_t seed = 0)
+* @brief Calcule l'empreinte de 64 bits d'une suite d'octets. Les octets sont
+*        lus par mots de 8, un mot de dictionnaire ne demande donc que deux
+*        ou trois multiplications.
+*
+* @param[in] data      début des octets
+* @param[in] length    nombre d'octets
+* @param[in] seed      graine, pour obtenir une autre fonction de hachage
+*
+* @return empreinte des octets.
+*/
+inline uint64_t hashBytes(const char *data, size_t length, uint64_t seed = 0) {
+    const uint64_t MULTIPLIER = 0x9e3779b97f4a7c15ULL;
+    uint64_t hash = (seed + length) * MULTIPLIER;
+
+    while (length >= 8) {
+        uint64_t word;
+        std::memcpy(&word, data, 8);
+        hash = (hash ^ word) * MULTIPLIER;
+        hash ^= hash >> 29;
+
+        data += 8;
+        length -= 8;
+    }
+
+    // Derniers octets, complétés par des zéros
+    if (length) {
+        uint64_t word = 0;
+        std::memcpy(&word, data, length);
+        hash = (hash ^ word) * MULTIPLIER;
+    }
+
+    return hashMix(hash);
+}
+
+// Base du hachage polynomial des mots, impaire pour être inversible modulo
+// 2^64
+const uint64_t WORD_HASH_BASE = 0x100000001b3ULL;
+
+/**
+* @fn inline uint64_t polynomialHash(const char* data, size_t length,
+*                                   uint64_t hash = 0)
+* @brief Poursuit le hachage polynomial d'un mot, modulo 2^64 : le mot
+*        c[0..n) vaut la somme des c[i] * WORD_HASH_BASE^(n - 1 - i). Le
+*        hachage d'un mot modifié à une position se déduit donc de ceux de
+*        son préfixe et de son suffixe en temps constant.
+*
+* @param[in] data      début des octets
+* @param[in] length    nombre d'octets
+* @param[in] hash      hachage des octets précédents
+*
+* @return hachage polynomial des octets.
+*/
+inline uint64_t polynomialHash(const char *data, size_t length, uint64_t hash = 0) {
+    for (size_t i = 0; i < length; ++i)
+        hash = hash * WORD_HASH_BASE + (unsigned char) data[i];
+
+    return hash;
+}
+
+/**
+* @fn inline uint64_t hashWord(uint64_t polynomial, size_t length)
+* @brief Obtient l'empreinte d'un mot à partir de son hachage polynomial.
+*        Les bits de poids faible du hachage polynomial ne dépendent que des
+*        derniers caractères : il est mélangé, avec la longueur du mot, avant
+*        de servir aux tables.
+*
+* @param[in] polynomial    hachage polynomial du mot
+* @param[in] length        longueur du mot
+*
+* @return empreinte du mot.
+*/
+inline uint64_t hashWord(uint64_t polynomial, size_t length) {
+    return hashMix(polynomial + length * 0x9e3779b97f4a7c15ULL);
+}
+
+/**
+* @fn inline uint64_t hashWord(const char* data, size_t length)
+* @brief Calcule l'empreinte d'un mot des tables consultées par les
+*        candidats de correction (voir Candidate.h).
+*
+* @param[in] data      début du mot
+* @param[in] length    longueur du mot
+*
+* @return empreinte du mot.
+*/
+inline uint64_t hashWord(const char *data, size_t length) {
+    return hashWord(polynomialHash(data, length), length);
+}
+
+/**
+* @fn inline size_t hashRange(uint64_t hash, size_t range)
+* @brief Ramène une empreinte dans [0, range) par une multiplication plutôt
+*        qu'une division. Seuls les bits de poids fort de l'empreinte
+*        comptent.
+*
+* @param[in] hash      empreinte
+* @param[in] range     nombre de valeurs possibles
+*
+* @return valeur dans [0, range).
+*/
+inline size_t hashRange(uint64_t hash, size_t range) {
+    return (size_t) (((unsigned __int128) hash * range) >> 64);
+}
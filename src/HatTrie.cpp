@@ -0,0 +1,355 @@
+/**
+*  @file HatTrie.cpp
+*  @brief Modélise un HAT-trie : un trie peu profond sur les premiers
+*         caractères des mots, dont les feuilles sont des tables de hachage
+*         compactes qui éclatent en noeuds du trie lorsqu'elles grandissent.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <cstdlib>
+#include <cstring>
+
+#include "Hash.h"
+#include "HatTrie.h"
+
+namespace {
+    /**
+    * @fn size_t lengthBytes(size_t length)
+    * @brief Obtient la taille de l'en-tête d'une fin de mot : un octet en
+    *        dessous de 128, deux au-delà (jusqu'à 32767).
+    */
+    size_t lengthBytes(size_t length) {
+        return length < 0x80 ? 1 : 2;
+    }
+
+    /**
+    * @fn size_t readLength(const char*& entry)
+    * @brief Lis l'en-tête d'une fin de mot et avance jusqu'à ses octets.
+    */
+    size_t readLength(const char *&entry) {
+        const size_t FIRST = (unsigned char) *entry++;
+        if (FIRST < 0x80)
+            return FIRST;
+
+        return ((FIRST & 0x7f) << 8) | (unsigned char) *entry++;
+    }
+
+    /**
+    * @fn char* writeLength(char* entry, size_t length)
+    * @brief Ecris l'en-tête d'une fin de mot.
+    *
+    * @return position des octets de la fin de mot.
+    */
+    char *writeLength(char *entry, size_t length) {
+        if (length < 0x80) {
+            *entry++ = (char) length;
+        } else {
+            *entry++ = (char) (0x80 | (length >> 8));
+            *entry++ = (char) (length & 0xff);
+        }
+
+        return entry;
+    }
+}
+
+HatTrie::HatTrie() : root(nullptr), nodes(0), buckets(0), slotBytes(0) {
+    clear();
+}
+
+HatTrie::~HatTrie() {
+    destroy(root);
+}
+
+bool HatTrie::insert(const std::string &word) {
+    TrieNode *node = root;
+
+    for (size_t i = 0;; ++i) {
+        if (i == word.length()) {
+            if (node->final)
+                return false;
+
+            node->final = true;
+            ++keys;
+            return true;
+        }
+
+        Node *&child = node->children[(unsigned char) word[i]];
+
+        if (!child)
+            child = newBucket();
+
+        if (child->trie) {
+            node = static_cast<TrieNode *>(child);
+            continue;
+        }
+
+        Bucket *bucket = static_cast<Bucket *>(child);
+
+        if (!insert(bucket, word.data() + i + 1, word.length() - i - 1))
+            return false;
+
+        if (bucket->count > BURST_LIMIT)
+            child = burst(bucket);
+
+        ++keys;
+        return true;
+    }
+}
+
+bool HatTrie::remove(const std::string &word) {
+    TrieNode *node = root;
+
+    for (size_t i = 0;; ++i) {
+        if (i == word.length()) {
+            if (!node->final)
+                return false;
+
+            node->final = false;
+            --keys;
+            return true;
+        }
+
+        Node *child = node->children[(unsigned char) word[i]];
+
+        if (!child)
+            return false;
+
+        if (child->trie) {
+            node = static_cast<TrieNode *>(child);
+            continue;
+        }
+
+        if (!remove(static_cast<Bucket *>(child), word.data() + i + 1,
+                    word.length() - i - 1))
+            return false;
+
+        --keys;
+        return true;
+    }
+}
+
+bool HatTrie::contains(const std::string &word) const {
+    const TrieNode *node = root;
+
+    for (size_t i = 0;; ++i) {
+        if (i == word.length())
+            return node->final;
+
+        const Node *child = node->children[(unsigned char) word[i]];
+
+        if (!child)
+            return false;
+
+        if (!child->trie)
+            return contains(static_cast<const Bucket *>(child), word.data() + i + 1,
+                            word.length() - i - 1);
+
+        node = static_cast<const TrieNode *>(child);
+    }
+}
+
+void HatTrie::clear() {
+    destroy(root);
+    root = newTrieNode();
+    keys = 0;
+}
+
+size_t HatTrie::size() const {
+    return keys;
+}
+
+size_t HatTrie::countNodes() const {
+    return nodes;
+}
+
+size_t HatTrie::countBuckets() const {
+    return buckets;
+}
+
+size_t HatTrie::memoryUsage() const {
+    return nodes * sizeof(TrieNode) + buckets * sizeof(Bucket) + slotBytes;
+}
+
+bool HatTrie::contains(const Bucket *bucket, const char *suffix, size_t length) const {
+    if (length == 0)
+        return bucket->final;
+
+    char *slot = bucket->slots[hashBytes(suffix, length) & (SLOTS - 1)];
+
+    return slot && *find(slot, suffix, length) != 0;
+}
+
+bool HatTrie::insert(Bucket *bucket, const char *suffix, size_t length) {
+    if (length == 0) {
+        if (bucket->final)
+            return false;
+
+        bucket->final = true;
+        return true;
+    }
+
+    char *&slot = bucket->slots[hashBytes(suffix, length) & (SLOTS - 1)];
+    size_t size = 0;
+
+    if (slot) {
+        const char *end = find(slot, suffix, length);
+        if (*end)
+            return false;
+
+        size = end - slot + 1;
+    }
+
+    // La case est réallouée à sa nouvelle taille exacte, la fin de mot
+    // remplace l'octet nul final.
+    const size_t GROWN = (size ? size : 1) + lengthBytes(length) + length;
+    slot = static_cast<char *>(std::realloc(slot, GROWN));
+
+    char *entry = writeLength(slot + GROWN - 1 - length - lengthBytes(length), length);
+    std::memcpy(entry, suffix, length);
+    slot[GROWN - 1] = 0;
+
+    slotBytes += GROWN - size;
+    ++bucket->count;
+
+    return true;
+}
+
+bool HatTrie::remove(Bucket *bucket, const char *suffix, size_t length) {
+    if (length == 0) {
+        if (!bucket->final)
+            return false;
+
+        bucket->final = false;
+        return true;
+    }
+
+    char *&slot = bucket->slots[hashBytes(suffix, length) & (SLOTS - 1)];
+    if (!slot)
+        return false;
+
+    char *entry = find(slot, suffix, length);
+    if (!*entry)
+        return false;
+
+    const size_t SIZE = slotSize(slot);
+    const size_t ENTRY = lengthBytes(length) + length;
+
+    std::memmove(entry, entry + ENTRY, slot + SIZE - (entry + ENTRY));
+
+    if (SIZE - ENTRY == 1) {
+        std::free(slot);
+        slot = nullptr;
+        slotBytes -= SIZE;
+    } else {
+        slot = static_cast<char *>(std::realloc(slot, SIZE - ENTRY));
+        slotBytes -= ENTRY;
+    }
+
+    --bucket->count;
+    return true;
+}
+
+HatTrie::Node *HatTrie::burst(Bucket *bucket) {
+    TrieNode *node = newTrieNode();
+    node->final = bucket->final;
+
+    // Chaque fin de mot passe dans le paquet de son premier octet.
+    for (const char *slot : bucket->slots) {
+        if (!slot)
+            continue;
+
+        const char *entry = slot;
+
+        while (*entry) {
+            const size_t LENGTH = readLength(entry);
+            Node *&child = node->children[(unsigned char) entry[0]];
+
+            if (!child)
+                child = newBucket();
+
+            insert(static_cast<Bucket *>(child), entry + 1, LENGTH - 1);
+            entry += LENGTH;
+        }
+    }
+
+    destroy(bucket);
+
+    for (Node *&child : node->children)
+        if (child && static_cast<Bucket *>(child)->count > BURST_LIMIT)
+            child = burst(static_cast<Bucket *>(child));
+
+    return node;
+}
+
+char *HatTrie::find(char *slot, const char *suffix, size_t length) {
+    char *entry = slot;
+
+    while (*entry) {
+        const char *bytes = entry;
+        const size_t LENGTH = readLength(bytes);
+
+        if (LENGTH == length && std::memcmp(bytes, suffix, length) == 0)
+            return entry;
+
+        entry = const_cast<char *>(bytes) + LENGTH;
+    }
+
+    return entry;
+}
+
+size_t HatTrie::slotSize(const char *slot) {
+    const char *entry = slot;
+
+    while (*entry) {
+        const size_t LENGTH = readLength(entry);
+        entry += LENGTH;
+    }
+
+    return entry - slot + 1;
+}
+
+HatTrie::TrieNode *HatTrie::newTrieNode() {
+    TrieNode *node = new TrieNode();
+    node->trie = true;
+    ++nodes;
+
+    return node;
+}
+
+HatTrie::Bucket *HatTrie::newBucket() {
+    Bucket *bucket = new Bucket();
+    bucket->trie = false;
+    ++buckets;
+
+    return bucket;
+}
+
+void HatTrie::destroy(Node *node) {
+    if (!node)
+        return;
+
+    if (node->trie) {
+        TrieNode *trie = static_cast<TrieNode *>(node);
+
+        for (Node *child : trie->children)
+            destroy(child);
+
+        delete trie;
+        --nodes;
+        return;
+    }
+
+    Bucket *bucket = static_cast<Bucket *>(node);
+
+    for (char *slot : bucket->slots)
+        if (slot) {
+            slotBytes -= slotSize(slot);
+            std::free(slot);
+        }
+
+    delete bucket;
+    --buckets;
+}
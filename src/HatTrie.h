@@ -0,0 +1,235 @@
+/**
+*  @file HatTrie.h
+*  @brief Modélise un HAT-trie : un trie peu profond sur les premiers
+*         caractères des mots, dont les feuilles sont des tables de hachage
+*         compactes qui éclatent en noeuds du trie lorsqu'elles grandissent.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+* Un noeud du trie a un enfant par octet. Sous un noeud, tous les mots qui
+* continuent par un même octet sont gardés dans un paquet : une table de
+* hachage de SLOTS cases, chaque case étant un tableau d'octets alloué à la
+* taille exacte de son contenu. Une case contient à la suite les fins des
+* mots, chacune précédée de sa longueur, et se termine par un octet nul. La
+* recherche d'un mot dans un paquet lit donc une seule zone contiguë.
+*
+* Un paquet qui dépasse BURST_LIMIT mots éclate : il est remplacé par un
+* noeud du trie et ses mots sont répartis dans de nouveaux paquets selon
+* leur premier octet.
+*/
+class HatTrie {
+public:
+    /**
+    * @fn HatTrie()
+    * @brief Constructeur d'un trie vide.
+    */
+    HatTrie();
+
+    HatTrie(const HatTrie &) = delete;
+
+    HatTrie &operator=(const HatTrie &) = delete;
+
+    /**
+    * @fn ~HatTrie()
+    * @brief Destructeur d'un trie, libération des noeuds et des paquets.
+    */
+    ~HatTrie();
+
+    /**
+    * @fn bool insert(const std::string& word)
+    * @brief Ajoute un mot au trie.
+    *
+    * @param[in] word     mot à ajouter, non vide
+    *
+    * @return true si le mot a été ajouté, false si il était déjà présent.
+    */
+    bool insert(const std::string &word);
+
+    /**
+    * @fn bool remove(const std::string& word)
+    * @brief Supprime un mot du trie. Les paquets ne sont jamais refusionnés.
+    *
+    * @param[in] word     mot à supprimer
+    *
+    * @return true si le mot a été supprimé, false si il était absent.
+    */
+    bool remove(const std::string &word);
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est dans le trie.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est présent, false sinon.
+    */
+    bool contains(const std::string &word) const;
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du trie.
+    */
+    void clear();
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots du trie.
+    *
+    * @return nombre de mots.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t countNodes() const
+    * @brief Obtient le nombre de noeuds du trie, la racine comprise.
+    *
+    * @return nombre de noeuds.
+    */
+    size_t countNodes() const;
+
+    /**
+    * @fn size_t countBuckets() const
+    * @brief Obtient le nombre de paquets du trie.
+    *
+    * @return nombre de paquets.
+    */
+    size_t countBuckets() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les noeuds, les paquets et leurs
+    *        cases.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    // Nombre de cases d'un paquet, une puissance de 2
+    static constexpr size_t SLOTS = 256;
+
+    // Nombre de mots au-delà duquel un paquet éclate
+    static constexpr size_t BURST_LIMIT = 4096;
+
+    /**
+    * @var   struct Node
+    * @brief En-tête commun aux noeuds et aux paquets.
+    */
+    struct Node {
+        bool trie;    // true pour un noeud du trie, false pour un paquet
+    };
+
+    /**
+    * @var   struct TrieNode
+    * @brief Noeud du trie.
+    */
+    struct TrieNode : Node {
+        bool final;                // un mot se termine sur le noeud
+        Node *children[256];       // noeud ou paquet de chaque octet suivant
+    };
+
+    /**
+    * @var   struct Bucket
+    * @brief Paquet des fins de mots qui suivent un même préfixe.
+    */
+    struct Bucket : Node {
+        bool final;                // le préfixe seul est un mot
+        uint32_t count;            // nombre de fins de mots non vides
+        char *slots[SLOTS];        // cases, nulles tant qu'elles sont vides
+    };
+
+    /**
+    * @fn bool contains(const Bucket* bucket, const char* suffix,
+    *                   size_t length) const
+    * @brief Indique si une fin de mot est dans un paquet.
+    */
+    bool contains(const Bucket *bucket, const char *suffix, size_t length) const;
+
+    /**
+    * @fn bool insert(Bucket* bucket, const char* suffix, size_t length)
+    * @brief Ajoute une fin de mot à un paquet.
+    *
+    * @return true si elle a été ajoutée, false si elle était présente.
+    */
+    bool insert(Bucket *bucket, const char *suffix, size_t length);
+
+    /**
+    * @fn bool remove(Bucket* bucket, const char* suffix, size_t length)
+    * @brief Supprime une fin de mot d'un paquet.
+    *
+    * @return true si elle a été supprimée, false si elle était absente.
+    */
+    bool remove(Bucket *bucket, const char *suffix, size_t length);
+
+    /**
+    * @fn Node* burst(Bucket* bucket)
+    * @brief Remplace un paquet par un noeud du trie qui répartit ses mots
+    *        dans de nouveaux paquets, eux-mêmes éclatés si besoin.
+    *
+    * @return noeud qui remplace le paquet.
+    */
+    Node *burst(Bucket *bucket);
+
+    /**
+    * @fn static char* find(char* slot, const char* suffix, size_t length)
+    * @brief Obtient la position d'une fin de mot dans une case, en-tête de
+    *        longueur compris, ou celle de l'octet nul qui termine la case.
+    */
+    static char *find(char *slot, const char *suffix, size_t length);
+
+    /**
+    * @fn static size_t slotSize(const char* slot)
+    * @brief Obtient la taille d'une case, octet nul final compris.
+    */
+    static size_t slotSize(const char *slot);
+
+    TrieNode *newTrieNode();
+
+    Bucket *newBucket();
+
+    /**
+    * @fn void destroy(Node* node)
+    * @brief Libère un noeud ou un paquet et tout ce qu'il contient.
+    */
+    void destroy(Node *node);
+
+    /**
+    * @var   TrieNode* root
+    * @brief Racine du trie, toujours présente.
+    */
+    TrieNode *root;
+
+    /**
+    * @var   size_t keys
+    * @brief Nombre de mots du trie.
+    */
+    size_t keys;
+
+    /**
+    * @var   size_t nodes
+    * @brief Nombre de noeuds du trie.
+    */
+    size_t nodes;
+
+    /**
+    * @var   size_t buckets
+    * @brief Nombre de paquets du trie.
+    */
+    size_t buckets;
+
+    /**
+    * @var   size_t slotBytes
+    * @brief Mémoire réservée par les cases des paquets.
+    */
+    size_t slotBytes;
+};
@@ -11,6 +11,8 @@
 
 #include <string>
 
+#include "Candidate.h"
+
 class IDictionary {
 public:
     /**
@@ -22,6 +24,12 @@ public:
     */
     IDictionary(const std::string &filename) : filename(filename) {}
 
+    /**
+    * @fn ~IDictionary()
+    * @brief Destructeur d'un dictionnaire.
+    */
+    virtual ~IDictionary() {}
+
     /**
     * @fn std::string getFilename() const
     * @brief Obtient le nom du fichier du dictionnaire.
@@ -74,6 +82,39 @@ public:
     */
     virtual bool contains(const std::string &word) = 0;
 
+    /**
+    * @fn bool containsCandidate(const Candidate& candidate)
+    * @brief Indique si un candidat de correction est contenu dans le
+    *        dictionnaire. Les dictionnaires à table de hachage le cherchent
+    *        par son empreinte, sans le construire ; les autres l'écrivent
+    *        dans la chaîne de son générateur et appellent contains().
+    *
+    * @param[in] candidate     candidat à rechercher
+    *
+    * @return true si le candidat est contenu dans le dictionnaire, false sinon
+    */
+    virtual bool containsCandidate(const Candidate &candidate) {
+        return contains(candidate.text());
+    }
+
+    /**
+    * @fn void containsCandidates(const Candidate* candidates, size_t count,
+    *                             bool* found)
+    * @brief Indique pour chaque candidat d'un lot si il est contenu dans le
+    *        dictionnaire. Les dictionnaires à table de hachage lancent le
+    *        chargement des cases de tous les candidats avant de les
+    *        comparer.
+    *
+    * @param[in] candidates    candidats à rechercher
+    * @param[in] count         nombre de candidats
+    * @param[out] found        found[i] vaut true si le candidat i est contenu
+    *                          dans le dictionnaire, false sinon
+    */
+    virtual void containsCandidates(const Candidate *candidates, size_t count, bool *found) {
+        for (size_t i = 0; i < count; ++i)
+            found[i] = containsCandidate(candidates[i]);
+    }
+
     /**
     * @fn size_t size() const = 0
     * @brief Obtient le nombre de mots contenus dans dictionnaire.
@@ -82,6 +123,15 @@ public:
     */
     virtual size_t size() const = 0;
 
+    /**
+    * @fn size_t memoryUsage() const = 0
+    * @brief Obtient une estimation de la mémoire utilisée par le contenu du
+    *        dictionnaire.
+    *
+    * @return nombre d'octets utilisés.
+    */
+    virtual size_t memoryUsage() const = 0;
+
 private:
     /**
     * @var   std::string filename
@@ -0,0 +1,78 @@
+/**
+*  @file ISuggestionEngine.h
+*  @brief Modélise un moteur de suggestions pour les mots mal orthographiés.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+* @var   struct Correction
+* @brief Correction possible d'un mot mal orthographié.
+*/
+struct Correction {
+    int type;           // 1 lettre en trop, 2 manquante, 3 erronée, 4 inversée
+    size_t position;    // position de l'erreur dans le mot
+    char letter;        // lettre ajoutée ou remplacée, nulle sinon
+    std::string word;   // mot corrigé
+    size_t distance = 1; // distance d'édition entre le mot et sa correction
+
+    /**
+    * @fn bool operator<(const Correction& other) const
+    * @brief Ordonne les corrections par distance, type, position puis
+    *        lettre, comme le correcteur orthographique les produit. Les
+    *        corrections plus lointaines, dont le type et la position sont
+    *        ceux de la première erreur, sont départagées par leur mot.
+    */
+    bool operator<(const Correction &other) const {
+        if (distance != other.distance)
+            return distance < other.distance;
+
+        if (type != other.type)
+            return type < other.type;
+
+        if (position != other.position)
+            return position < other.position;
+
+        if (letter != other.letter)
+            return letter < other.letter;
+
+        return word < other.word;
+    }
+};
+
+class ISuggestionEngine {
+public:
+    /**
+    * @fn ~ISuggestionEngine()
+    * @brief Destructeur d'un moteur de suggestions.
+    */
+    virtual ~ISuggestionEngine() {}
+
+    /**
+    * @fn void suggest(const std::string& word,
+    *                  std::vector<Correction>& corrections) = 0
+    * @brief Ajoute les corrections du mot, dans l'ordre de Correction. Une
+    *        même correction à distance d'édition 1 obtenue par plusieurs
+    *        positions est ajoutée pour chacune d'elles.
+    *
+    * @param[in] word           mot mal orthographié, nettoyé
+    * @param[out] corrections   tableau auquel ajouter les corrections
+    */
+    virtual void suggest(const std::string &word,
+                         std::vector<Correction> &corrections) = 0;
+
+    /**
+    * @fn size_t memoryUsage() const = 0
+    * @brief Obtient la mémoire utilisée par le moteur.
+    *
+    * @return nombre d'octets utilisés.
+    */
+    virtual size_t memoryUsage() const = 0;
+};
@@ -0,0 +1,123 @@
+/**
+*  @file LevenshteinEngine.cpp
+*  @brief Modélise un moteur de suggestions qui intersecte l'automate de
+*         Levenshtein d'un mot avec l'automate minimal du dictionnaire.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+
+#include "EditDistance.h"
+#include "LevenshteinEngine.h"
+#include "Tools.h"
+
+LevenshteinEngine::LevenshteinEngine(const std::string &filename, size_t distance)
+        : distance(std::max<size_t>(distance, 1)) {
+    // L'automate se construit à partir des mots triés et sans doublon.
+    std::vector<std::string> words(loadSortedWords(filename));
+
+    dawg.build(words);
+}
+
+void LevenshteinEngine::suggest(const std::string &word,
+                                std::vector<Correction> &corrections) {
+    if (word.empty() || dawg.countStates() == 0)
+        return;
+
+    const size_t LENGTH = word.length();
+    const size_t FIRST = corrections.size();
+
+    this->word = word;
+    prefix.clear();
+
+    // Un préfixe plus long que le mot de plus de distance lettres ne mène à
+    // aucune correction.
+    rows.resize((LENGTH + distance + 1) * (LENGTH + 1));
+
+    // Distances entre le préfixe vide et chaque préfixe du mot
+    uint32_t *first = row(0);
+    for (size_t j = 0; j <= LENGTH; ++j)
+        first[j] = (uint32_t) std::min(j, distance + 1);
+
+    search(0, 0, corrections);
+
+    std::sort(corrections.begin() + FIRST, corrections.end());
+}
+
+size_t LevenshteinEngine::getDistance() const {
+    return distance;
+}
+
+size_t LevenshteinEngine::countStates() const {
+    return dawg.countStates();
+}
+
+size_t LevenshteinEngine::memoryUsage() const {
+    return dawg.memoryUsage();
+}
+
+void LevenshteinEngine::search(uint32_t state, size_t depth,
+                               std::vector<Correction> &corrections) {
+    const size_t LENGTH = word.length();
+
+    if (dawg.isFinal(state) && depth + distance >= LENGTH
+        && row(depth)[LENGTH] <= distance)
+        addCorrections(word, prefix, distance, corrections);
+
+    if (depth == LENGTH + distance)
+        return;
+
+    // Les distances sont bornées à LIMIT : au-delà de la distance maximale,
+    // leur valeur n'importe plus. Ajouter ou remplacer un caractère qui n'est
+    // pas une lettre coûte LIMIT, ce qui l'exclut de toute correction.
+    const uint32_t LIMIT = (uint32_t) distance + 1;
+
+    // Seules les colonnes à moins de distance de la diagonale peuvent rester
+    // sous la limite. Les colonnes voisines de cette bande valent LIMIT, les
+    // autres ne sont jamais lues.
+    const size_t DEPTH = depth + 1;
+    const size_t LOW = DEPTH > distance ? DEPTH - distance : 0;
+    const size_t HIGH = std::min(DEPTH + distance, LENGTH);
+
+    const uint32_t *previous = row(depth);
+    const uint32_t *beforePrevious = depth ? row(depth - 1) : nullptr;
+    uint32_t *current = row(DEPTH);
+
+    for (uint32_t edge = dawg.firstEdge(state); edge < dawg.endEdge(state); ++edge) {
+        const char c = dawg.getLabel(edge);
+
+        const uint32_t EDIT = isLetter(c) ? 1 : LIMIT;
+        uint32_t minimum = LIMIT;
+
+        if (LOW == 0)
+            minimum = current[0] = std::min(previous[0] + EDIT, LIMIT);
+        else
+            current[LOW - 1] = LIMIT;
+
+        if (HIGH < LENGTH)
+            current[HIGH + 1] = LIMIT;
+
+        for (size_t j = std::max<size_t>(LOW, 1); j <= HIGH; ++j) {
+            uint32_t cost = std::min(previous[j - 1] + (word[j - 1] == c ? 0 : EDIT),
+                                     std::min(previous[j] + EDIT, current[j - 1] + 1));
+
+            // Inversion des deux dernières lettres
+            if (beforePrevious && j > 1 && word[j - 2] == c
+                && word[j - 1] == prefix[depth - 1])
+                cost = std::min(cost, beforePrevious[j - 2] + 1);
+
+            current[j] = std::min(cost, LIMIT);
+            minimum = std::min(minimum, cost);
+        }
+
+        if (minimum > distance)
+            continue;
+
+        prefix.push_back(c);
+        search(dawg.getTarget(edge), depth + 1, corrections);
+        prefix.pop_back();
+    }
+}
@@ -0,0 +1,133 @@
+/**
+*  @file LevenshteinEngine.h
+*  @brief Modélise un moteur de suggestions qui intersecte l'automate de
+*         Levenshtein d'un mot avec l'automate minimal du dictionnaire.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Dawg.h"
+#include "ISuggestionEngine.h"
+
+/**
+* La distance est celle de Damerau-Levenshtein restreinte décrite dans
+* EditDistance.h. L'automate de Levenshtein du mot est simulé : son état
+* après un préfixe du dictionnaire est la ligne de la matrice des distances
+* entre ce préfixe et les préfixes du mot. Le dictionnaire est parcouru en profondeur et une
+* transition n'est suivie que si une valeur de la nouvelle ligne ne dépasse
+* pas la distance maximale. Les suffixes communs étant partagés par
+* l'automate minimal, chaque mot du dictionnaire n'est atteint que par un
+* seul chemin.
+*/
+class LevenshteinEngine : public ISuggestionEngine {
+public:
+    /**
+    * @fn LevenshteinEngine(const std::string& filename, size_t distance)
+    * @brief Constructeur du moteur avec le nom du fichier du dictionnaire et
+    *        la distance d'édition maximale des corrections. Les mots ajoutés
+    *        ou supprimés du dictionnaire par la suite ne sont pas pris en
+    *        compte.
+    *
+    * @param[in] filename      nom du fichier du dictionnaire
+    * @param[in] distance      distance d'édition maximale, au moins 1
+    */
+    LevenshteinEngine(const std::string &filename, size_t distance);
+
+    /**
+    * @fn void suggest(const std::string& word,
+    *                  std::vector<Correction>& corrections)
+    * @brief Ajoute les corrections du mot jusqu'à la distance maximale, dans
+    *        l'ordre de Correction. A distance 1, les corrections sont celles
+    *        générées lettre par lettre ; au-delà, chaque mot n'est ajouté
+    *        qu'une fois, avec le type, la position et la lettre de sa
+    *        première erreur.
+    *
+    * @param[in] word           mot mal orthographié, nettoyé
+    * @param[out] corrections   tableau auquel ajouter les corrections
+    */
+    void suggest(const std::string &word, std::vector<Correction> &corrections);
+
+    /**
+    * @fn size_t getDistance() const
+    * @brief Obtient la distance d'édition maximale des corrections.
+    *
+    * @return distance maximale.
+    */
+    size_t getDistance() const;
+
+    /**
+    * @fn size_t countStates() const
+    * @brief Obtient le nombre d'états de l'automate du dictionnaire.
+    *
+    * @return nombre d'états.
+    */
+    size_t countStates() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par l'automate du dictionnaire.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @fn void search(uint32_t state, size_t depth,
+    *                 std::vector<Correction>& corrections)
+    * @brief Suit les transitions de l'état dont la ligne de distances reste
+    *        sous la distance maximale.
+    *
+    * @param[in] state          état atteint par le préfixe courant
+    * @param[in] depth          longueur du préfixe courant
+    * @param[out] corrections   tableau auquel ajouter les corrections
+    */
+    void search(uint32_t state, size_t depth, std::vector<Correction> &corrections);
+
+    /**
+    * @fn uint32_t* row(size_t depth)
+    * @brief Obtient la ligne des distances d'un préfixe du dictionnaire.
+    */
+    uint32_t *row(size_t depth) {
+        return rows.data() + depth * (word.length() + 1);
+    }
+
+    /**
+    * @var   Dawg dawg
+    * @brief Automate des mots du dictionnaire.
+    */
+    Dawg dawg;
+
+    /**
+    * @var   size_t distance
+    * @brief Distance d'édition maximale des corrections.
+    */
+    size_t distance;
+
+    /**
+    * @var   std::string word
+    * @brief Mot en cours de correction.
+    */
+    std::string word;
+
+    /**
+    * @var   std::string prefix
+    * @brief Préfixe du dictionnaire en cours de parcours.
+    */
+    std::string prefix;
+
+    /**
+    * @var   std::vector<uint32_t> rows
+    * @brief Ligne des distances de chaque préfixe du préfixe courant, les
+    *        unes à la suite des autres.
+    */
+    std::vector<uint32_t> rows;
+};
@@ -0,0 +1,120 @@
+/**
+*  @file Louds.cpp
+*  @brief Modélise un trie succinct encodé par la suite unaire des degrés de
+*         ses noeuds dans l'ordre d'un parcours en largeur (Level-Order Unary
+*         Degree Sequence).
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <cstdint>
+
+#include "Louds.h"
+
+Louds::Louds() {
+    clear();
+}
+
+void Louds::build(const std::vector<std::string> &words) {
+    clear();
+
+    // Mots partageant le préfixe d'un noeud : [begin, end) dans words.
+    struct Range {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    std::vector<Range> level(1, Range{0, (uint32_t) words.size()});
+    std::vector<Range> next;
+
+    // Super-racine, dont la racine est l'unique enfant
+    tree.push_back(true);
+    tree.push_back(false);
+    labels.push_back(0);
+
+    for (size_t depth = 0; !level.empty(); ++depth) {
+        next.clear();
+
+        for (const Range &range : level) {
+            uint32_t i = range.begin;
+
+            // Triés, les mots de même préfixe commencent par le plus court.
+            const bool final = i < range.end && words[i].length() == depth;
+            finals.push_back(final);
+            if (final)
+                ++i;
+
+            while (i < range.end) {
+                const char c = words[i][depth];
+                uint32_t j = i + 1;
+
+                while (j < range.end && words[j][depth] == c)
+                    ++j;
+
+                tree.push_back(true);
+                labels.push_back(c);
+                next.push_back(Range{i, j});
+                i = j;
+            }
+
+            tree.push_back(false);
+        }
+
+        level.swap(next);
+    }
+
+    tree.build();
+    labels.shrink_to_fit();
+    finals.shrink_to_fit();
+    keys = words.size();
+}
+
+void Louds::clear() {
+    tree.clear();
+    std::vector<char>().swap(labels);
+    std::vector<bool>().swap(finals);
+    keys = 0;
+}
+
+bool Louds::contains(const std::string &word) const {
+    if (finals.empty())
+        return false;
+
+    size_t node = 0;
+
+    for (char c : word) {
+        // Les enfants suivent le bit à 0 qui termine le noeud précédent.
+        const size_t position = tree.select0(node) + 1;
+        const size_t degree = tree.countOnes(position);
+        const size_t first = position - node - 1;
+        const size_t last = first + degree;
+
+        // Les caractères des enfants sont triés dans l'ordre des mots.
+        size_t child = first;
+        while (child < last && (unsigned char) labels[child] < (unsigned char) c)
+            ++child;
+
+        if (child == last || labels[child] != c)
+            return false;
+
+        node = child;
+    }
+
+    return finals[node];
+}
+
+size_t Louds::countKeys() const {
+    return keys;
+}
+
+size_t Louds::countNodes() const {
+    return finals.size();
+}
+
+size_t Louds::memoryUsage() const {
+    return tree.memoryUsage()
+           + labels.capacity() * sizeof(char)
+           + finals.capacity() / 8;
+}
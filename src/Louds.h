@@ -0,0 +1,108 @@
+/**
+*  @file Louds.h
+*  @brief Modélise un trie succinct encodé par la suite unaire des degrés de
+*         ses noeuds dans l'ordre d'un parcours en largeur (Level-Order Unary
+*         Degree Sequence).
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "BitVector.h"
+
+/**
+* Les noeuds sont numérotés dans l'ordre du parcours en largeur, la racine
+* porte le numéro 0. La structure du trie est décrite par les bits "10" d'une
+* super-racine suivis, pour chaque noeud, d'un bit à 1 par enfant puis d'un
+* bit à 0. Les enfants du noeud k sont donc les bits à 1 qui suivent le k-ième
+* bit à 0, et le premier d'entre eux à la position p est le noeud p - k - 1.
+* Le trie utilise ainsi deux bits par noeud, un caractère et un indicateur de
+* fin de mot, plus les index de select.
+*/
+class Louds {
+public:
+    /**
+    * @fn Louds()
+    * @brief Constructeur d'un trie vide.
+    */
+    Louds();
+
+    /**
+    * @fn void build(const std::vector<std::string>& words)
+    * @brief Construit le trie des mots, en remplaçant le contenu actuel.
+    *
+    * @param[in] words     mots triés, sans doublon ni mot vide
+    */
+    void build(const std::vector<std::string> &words);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu du trie.
+    */
+    void clear();
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est une clé du trie.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est contenu dans le trie, false sinon.
+    */
+    bool contains(const std::string &word) const;
+
+    /**
+    * @fn size_t countKeys() const
+    * @brief Obtient le nombre de clés du trie.
+    *
+    * @return nombre de clés.
+    */
+    size_t countKeys() const;
+
+    /**
+    * @fn size_t countNodes() const
+    * @brief Obtient le nombre de noeuds du trie, la racine comprise.
+    *
+    * @return nombre de noeuds.
+    */
+    size_t countNodes() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les tableaux du trie.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @var   BitVector tree
+    * @brief Suite unaire des degrés des noeuds.
+    */
+    BitVector tree;
+
+    /**
+    * @var   std::vector<char> labels
+    * @brief Caractère de l'arête menant à chaque noeud, nul pour la racine.
+    */
+    std::vector<char> labels;
+
+    /**
+    * @var   std::vector<bool> finals
+    * @brief Indique pour chaque noeud s'il termine un mot.
+    */
+    std::vector<bool> finals;
+
+    /**
+    * @var   size_t keys
+    * @brief Nombre de clés du trie.
+    */
+    size_t keys;
+};
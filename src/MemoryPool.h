@@ -0,0 +1,122 @@
+/**
+*  @file MemoryPool.h
+*  @brief Modélise un pool d'allocation par blocs (arena) pour des objets de
+*         taille fixe.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+template<typename T, size_t CHUNK_SIZE = 4096>
+class MemoryPool {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "MemoryPool libère ses blocs sans appeler de destructeur");
+
+public:
+    /**
+    * @fn MemoryPool()
+    * @brief Constructeur d'un pool vide. Aucun bloc n'est alloué avant la
+    *        première demande.
+    */
+    MemoryPool() : used(CHUNK_SIZE), freeList(nullptr) {}
+
+    MemoryPool(const MemoryPool &) = delete;
+
+    MemoryPool &operator=(const MemoryPool &) = delete;
+
+    /**
+    * @fn T* allocate()
+    * @brief Obtient un objet initialisé à zéro. Réutilise en priorité un
+    *        emplacement libéré, sinon prend le suivant dans le bloc courant.
+    *
+    * @return pointeur sur l'objet alloué.
+    */
+    T *allocate() {
+        Slot *slot = freeList;
+
+        if (slot) {
+            freeList = slot->next;
+        } else {
+            if (used == CHUNK_SIZE) {
+                chunks.emplace_back(new Slot[CHUNK_SIZE]);
+                used = 0;
+            }
+
+            slot = &chunks.back()[used++];
+        }
+
+        return new(slot->storage) T();
+    }
+
+    /**
+    * @fn void deallocate(T* object)
+    * @brief Rend un objet au pool. Son emplacement sera réutilisé par la
+    *        prochaine allocation.
+    *
+    * @param[in] object    objet à rendre
+    */
+    void deallocate(T *object) {
+        Slot *slot = reinterpret_cast<Slot *>(object);
+        slot->next = freeList;
+        freeList = slot;
+    }
+
+    /**
+    * @fn void clear()
+    * @brief Libère tous les blocs en une seule fois. Les pointeurs obtenus
+    *        auparavant deviennent invalides.
+    */
+    void clear() {
+        chunks.clear();
+        used = CHUNK_SIZE;
+        freeList = nullptr;
+    }
+
+    /**
+    * @fn size_t capacity() const
+    * @brief Obtient le nombre d'objets que les blocs alloués peuvent contenir.
+    *
+    * @return nombre d'emplacements réservés.
+    */
+    size_t capacity() const {
+        return chunks.size() * CHUNK_SIZE;
+    }
+
+private:
+    /**
+    * @var   union Slot
+    * @brief Emplacement d'un objet. Un emplacement libre sert de maillon à
+    *        la liste des emplacements libres.
+    */
+    union Slot {
+        Slot *next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    /**
+    * @var   std::vector<std::unique_ptr<Slot[]>> chunks
+    * @brief Blocs contigus de CHUNK_SIZE emplacements.
+    */
+    std::vector<std::unique_ptr<Slot[]>> chunks;
+
+    /**
+    * @var   size_t used
+    * @brief Nombre d'emplacements déjà distribués dans le dernier bloc.
+    */
+    size_t used;
+
+    /**
+    * @var   Slot* freeList
+    * @brief Liste des emplacements rendus au pool.
+    */
+    Slot *freeList;
+};
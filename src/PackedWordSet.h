@@ -0,0 +1,316 @@
+/**
+*  @file PackedWordSet.h
+*  @brief Modélise un ensemble de mots dont les mots courts sont rangés dans
+*         des clés de 128 bits, comparées en une instruction.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "FlatHashSet.h"
+#include "Hash.h"
+
+/**
+* Un mot d'au plus MAX_LENGTH octets, sans octet nul, est copié dans une clé
+* de 16 octets complétée par des zéros. Les clés sont rangées dans une table
+* à adressage ouvert et sondage linéaire, où la clé nulle marque une case
+* vide : une recherche compare des clés entières, sans jamais lire de
+* caractères ailleurs. Les autres mots sont gardés dans un FlatHashSet.
+*/
+class PackedWordSet {
+public:
+    // Longueur maximale d'un mot rangé dans une clé
+    static constexpr size_t MAX_LENGTH = 16;
+
+    /**
+    * @fn PackedWordSet()
+    * @brief Constructeur d'un ensemble vide.
+    */
+    PackedWordSet() {
+        clear();
+    }
+
+    /**
+    * @fn void clear()
+    * @brief Supprime tous les mots et rend la mémoire.
+    */
+    void clear() {
+        std::vector<Key>().swap(keys);
+        longWords.clear();
+        count = 0;
+        mask = 0;
+    }
+
+    /**
+    * @fn void reserve(size_t words)
+    * @brief Dimensionne la table des clés pour contenir le nombre de mots
+    *        sans l'agrandir.
+    *
+    * @param[in] words     nombre de mots courts prévus
+    */
+    void reserve(size_t words) {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity * MAX_LOAD_NUM < words * MAX_LOAD_DEN)
+            capacity *= 2;
+
+        if (capacity > keys.size())
+            rehash(capacity);
+    }
+
+    /**
+    * @fn bool insert(const std::string& word)
+    * @brief Ajoute un mot à l'ensemble, s'il n'y est pas présent.
+    *
+    * @param[in] word      mot à ajouter
+    *
+    * @return true si le mot a été ajouté, false s'il était déjà présent.
+    */
+    bool insert(const std::string &word) {
+        Key key;
+        if (!pack(word, key))
+            return longWords.insert(word);
+
+        if ((count + 1) * MAX_LOAD_DEN > keys.size() * MAX_LOAD_NUM)
+            rehash(keys.empty() ? MIN_CAPACITY : 2 * keys.size());
+
+        size_t slot = home(key);
+        while (!isEmpty(keys[slot])) {
+            if (equals(keys[slot], key))
+                return false;
+
+            slot = (slot + 1) & mask;
+        }
+
+        keys[slot] = key;
+        ++count;
+
+        return true;
+    }
+
+    /**
+    * @fn size_t erase(const std::string& word)
+    * @brief Supprime un mot de l'ensemble. Les clés suivantes de la même
+    *        suite de cases sont reculées, la table n'a jamais de case
+    *        supprimée.
+    *
+    * @param[in] word      mot à supprimer
+    *
+    * @return nombre de mots supprimés.
+    */
+    size_t erase(const std::string &word) {
+        Key key;
+        if (!pack(word, key))
+            return longWords.erase(word);
+
+        if (keys.empty())
+            return 0;
+
+        size_t slot = home(key);
+        while (!equals(keys[slot], key)) {
+            if (isEmpty(keys[slot]))
+                return 0;
+
+            slot = (slot + 1) & mask;
+        }
+
+        // Une clé suivante remplace le trou si sa case d'origine n'est pas
+        // entre le trou et sa position.
+        size_t hole = slot;
+        for (size_t next = (slot + 1) & mask; !isEmpty(keys[next]); next = (next + 1) & mask) {
+            const size_t HOME = home(keys[next]);
+
+            if (((next - HOME) & mask) >= ((next - hole) & mask)) {
+                keys[hole] = keys[next];
+                hole = next;
+            }
+        }
+
+        keys[hole] = Key{0, 0};
+        --count;
+
+        return 1;
+    }
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est dans l'ensemble.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est présent, false sinon.
+    */
+    bool contains(const std::string &word) const {
+        Key key;
+        if (!pack(word, key))
+            return longWords.contains(word);
+
+        if (keys.empty())
+            return false;
+
+        for (size_t slot = home(key);; slot = (slot + 1) & mask) {
+            if (equals(keys[slot], key))
+                return true;
+
+            if (isEmpty(keys[slot]))
+                return false;
+        }
+    }
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots de l'ensemble.
+    *
+    * @return nombre de mots.
+    */
+    size_t size() const {
+        return count + longWords.size();
+    }
+
+    /**
+    * @fn size_t countPacked() const
+    * @brief Obtient le nombre de mots rangés dans des clés.
+    *
+    * @return nombre de mots courts.
+    */
+    size_t countPacked() const {
+        return count;
+    }
+
+    /**
+    * @fn size_t capacity() const
+    * @brief Obtient le nombre de cases de la table des clés.
+    *
+    * @return nombre de cases.
+    */
+    size_t capacity() const {
+        return keys.size();
+    }
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les clés et par les mots longs.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const {
+        return keys.capacity() * sizeof(Key) + longWords.memoryUsage();
+    }
+
+private:
+    // Nombre minimal de cases, une puissance de 2
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    // Taux de remplissage maximal, 3/4 : le sondage linéaire reste court.
+    static constexpr size_t MAX_LOAD_NUM = 3;
+    static constexpr size_t MAX_LOAD_DEN = 4;
+
+    /**
+    * @var   struct Key
+    * @brief Mot court complété par des zéros, nul pour une case vide.
+    */
+    struct alignas(16) Key {
+        uint64_t low;
+        uint64_t high;
+    };
+
+    /**
+    * @fn static bool pack(const std::string& word, Key& key)
+    * @brief Range un mot dans une clé.
+    *
+    * @return true si le mot tient dans une clé, false sinon.
+    */
+    static bool pack(const std::string &word, Key &key) {
+        const size_t LENGTH = word.length();
+
+        // Un octet nul rendrait deux mots de longueurs différentes égaux.
+        if (LENGTH == 0 || LENGTH > MAX_LENGTH
+            || std::memchr(word.data(), 0, LENGTH) != nullptr)
+            return false;
+
+        char bytes[MAX_LENGTH] = {};
+        std::memcpy(bytes, word.data(), LENGTH);
+        std::memcpy(&key, bytes, sizeof(key));
+
+        return true;
+    }
+
+    static bool isEmpty(const Key &key) {
+        return (key.low | key.high) == 0;
+    }
+
+    /**
+    * @fn static bool equals(const Key& a, const Key& b)
+    * @brief Compare deux clés, les 16 octets en une instruction avec SSE2.
+    */
+    static bool equals(const Key &a, const Key &b) {
+#ifdef __SSE2__
+        const __m128i A = _mm_load_si128(reinterpret_cast<const __m128i *>(&a));
+        const __m128i B = _mm_load_si128(reinterpret_cast<const __m128i *>(&b));
+
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(A, B)) == 0xffff;
+#else
+        return ((a.low ^ b.low) | (a.high ^ b.high)) == 0;
+#endif
+    }
+
+    size_t home(const Key &key) const {
+        return hashMix(key.low ^ hashMix(key.high)) & mask;
+    }
+
+    /**
+    * @fn void rehash(size_t capacity)
+    * @brief Replace toutes les clés dans une table du nombre de cases donné.
+    */
+    void rehash(size_t capacity) {
+        std::vector<Key> previous(capacity, Key{0, 0});
+        previous.swap(keys);
+        mask = capacity - 1;
+
+        for (const Key &key : previous) {
+            if (isEmpty(key))
+                continue;
+
+            size_t slot = home(key);
+            while (!isEmpty(keys[slot]))
+                slot = (slot + 1) & mask;
+
+            keys[slot] = key;
+        }
+    }
+
+    /**
+    * @var   std::vector<Key> keys
+    * @brief Table des clés, dont le nombre de cases est une puissance de 2.
+    */
+    std::vector<Key> keys;
+
+    /**
+    * @var   FlatHashSet longWords
+    * @brief Mots trop longs pour une clé.
+    */
+    FlatHashSet longWords;
+
+    /**
+    * @var   size_t count
+    * @brief Nombre de clés de la table.
+    */
+    size_t count;
+
+    /**
+    * @var   size_t mask
+    * @brief Nombre de cases moins un.
+    */
+    size_t mask;
+};
@@ -0,0 +1,178 @@
+/**
+*  @file PerfectHashSet.cpp
+*  @brief Modélise un ensemble de mots figé, indexé par une fonction de
+*         hachage parfaite minimale.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "Hash.h"
+#include "PerfectHashSet.h"
+
+// Nombre moyen de mots par paquet
+#define BUCKET_SIZE 4
+
+// Nombre moyen de pilotes essayés par mot avant d'abandonner la construction
+#define PILOT_TRIES 64
+
+PerfectHashSet::PerfectHashSet() {
+    clear();
+}
+
+bool PerfectHashSet::build(std::vector<std::string> &words) {
+    clear();
+
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+
+    if (words.empty())
+        return true;
+
+    // Empreinte de chaque mot avec son numéro. Les rares mots différents de
+    // même empreinte ne peuvent pas recevoir de case : seul le premier est
+    // indexé, les autres sont gardés à part.
+    std::vector<std::pair<uint64_t, uint32_t>> entries(words.size());
+    for (uint32_t i = 0; i < words.size(); ++i)
+        entries[i] = std::make_pair(hashWord(words[i].data(), words[i].length()), i);
+
+    std::sort(entries.begin(), entries.end());
+
+    std::vector<uint64_t> hashes;
+    std::vector<uint32_t> indexed;
+
+    for (size_t i = 0; i < entries.size(); ++i)
+        if (i > 0 && entries[i].first == entries[i - 1].first) {
+            collisions.emplace_back(entries[i].first, words[entries[i].second]);
+        } else {
+            hashes.push_back(entries[i].first);
+            indexed.push_back(entries[i].second);
+        }
+
+    const size_t WORDS = hashes.size();
+    const uint64_t MAX_PILOT = std::min<uint64_t>(PILOT_TRIES * (uint64_t) WORDS,
+                                                  UINT32_MAX);
+
+    // Mots de chaque paquet, regroupés par un tri par dénombrement
+    const size_t BUCKETS = (WORDS + BUCKET_SIZE - 1) / BUCKET_SIZE;
+    std::vector<uint32_t> starts(BUCKETS + 1, 0);
+    std::vector<uint32_t> members(WORDS);
+
+    for (uint64_t hash : hashes)
+        ++starts[hashRange(hash, BUCKETS) + 1];
+
+    for (size_t b = 0; b < BUCKETS; ++b)
+        starts[b + 1] += starts[b];
+
+    std::vector<uint32_t> next(starts.begin(), starts.end() - 1);
+    for (uint32_t i = 0; i < WORDS; ++i)
+        members[next[hashRange(hashes[i], BUCKETS)]++] = i;
+
+    // Les plus gros paquets sont placés d'abord, tant que les cases libres
+    // sont nombreuses.
+    std::vector<uint32_t> order(BUCKETS);
+    for (uint32_t b = 0; b < BUCKETS; ++b)
+        order[b] = b;
+
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return starts[a + 1] - starts[a] > starts[b + 1] - starts[b];
+    });
+
+    pilots.assign(BUCKETS, 0);
+    offsets.assign(WORDS + 1, 0);
+
+    std::vector<bool> taken(WORDS, false);
+    std::vector<uint32_t> owners(WORDS);
+    std::vector<size_t> slots;
+
+    for (uint32_t bucket : order) {
+        const uint32_t FIRST = starts[bucket];
+        const uint32_t LAST = starts[bucket + 1];
+
+        for (uint32_t pilot = 0;; ++pilot) {
+            if (pilot == MAX_PILOT) {
+                clear();
+                return false;
+            }
+
+            slots.clear();
+
+            for (uint32_t i = FIRST; i < LAST; ++i) {
+                const size_t slot = position(hashes[members[i]], pilot);
+
+                if (taken[slot]
+                    || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                    break;
+
+                slots.push_back(slot);
+            }
+
+            if (slots.size() != LAST - FIRST)
+                continue;
+
+            for (size_t i = 0; i < slots.size(); ++i) {
+                taken[slots[i]] = true;
+                owners[slots[i]] = members[FIRST + i];
+            }
+
+            pilots[bucket] = pilot;
+            break;
+        }
+    }
+
+    // Mots rangés dans l'ordre de leur case
+    for (size_t slot = 0; slot < WORDS; ++slot) {
+        offsets[slot] = (uint32_t) letters.size();
+        letters += words[indexed[owners[slot]]];
+    }
+
+    offsets[WORDS] = (uint32_t) letters.size();
+    letters.shrink_to_fit();
+
+    return true;
+}
+
+void PerfectHashSet::clear() {
+    std::vector<uint32_t>().swap(pilots);
+    std::string().swap(letters);
+    std::vector<uint32_t>(1, 0).swap(offsets);
+    std::vector<std::pair<uint64_t, std::string>>().swap(collisions);
+}
+
+size_t PerfectHashSet::position(uint64_t hash, uint32_t pilot) const {
+    // Le paquet est choisi par les bits de poids fort de l'empreinte, qui
+    // est donc mélangée avec le pilote avant d'en tirer la case.
+    return hashRange(hashMix(hash ^ (pilot * 0x9e3779b97f4a7c15ULL)),
+                     offsets.size() - 1);
+}
+
+size_t PerfectHashSet::find(uint64_t hash) const {
+    return position(hash, pilots[hashRange(hash, pilots.size())]);
+}
+
+bool PerfectHashSet::contains(const std::string &word) const {
+    return contains(hashWord(word.data(), word.length()),
+                    [&word](const char *data, size_t length) {
+                        return length == word.length()
+                               && std::memcmp(data, word.data(), length) == 0;
+                    });
+}
+
+size_t PerfectHashSet::size() const {
+    return offsets.size() - 1 + collisions.size();
+}
+
+size_t PerfectHashSet::countBuckets() const {
+    return pilots.size();
+}
+
+size_t PerfectHashSet::memoryUsage() const {
+    return pilots.capacity() * sizeof(uint32_t)
+           + letters.capacity()
+           + offsets.capacity() * sizeof(uint32_t)
+           + collisions.capacity() * sizeof(std::pair<uint64_t, std::string>);
+}
@@ -0,0 +1,158 @@
+/**
+*  @file PerfectHashSet.h
+*  @brief Modélise un ensemble de mots figé, indexé par une fonction de
+*         hachage parfaite minimale.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+* Les n mots sont répartis par leur empreinte dans environ n / 4 paquets.
+* Chaque paquet reçoit un pilote, choisi à la construction pour que ses mots
+* tombent dans des cases encore libres parmi n (méthode PTHash, proche de
+* CHD) : la case d'un mot ne dépend que de son empreinte et du pilote de son
+* paquet. Les mots sont rangés à la suite dans l'ordre de leur case. Une
+* recherche coûte donc un hachage, la lecture d'un pilote et une comparaison.
+* Les mots dont l'empreinte est déjà prise, presque jamais, sont comparés à
+* part.
+*/
+class PerfectHashSet {
+public:
+    /**
+    * @fn PerfectHashSet()
+    * @brief Constructeur d'un ensemble vide.
+    */
+    PerfectHashSet();
+
+    /**
+    * @fn bool build(std::vector<std::string>& words)
+    * @brief Construit la fonction de hachage des mots, en remplaçant le
+    *        contenu actuel. Les mots sont triés et leurs doublons retirés.
+    *
+    * @param[in,out] words     mots à ajouter
+    *
+    * @return true si la fonction a été construite, false si un paquet n'a
+    *         trouvé aucun pilote ; l'ensemble est alors vide.
+    */
+    bool build(std::vector<std::string> &words);
+
+    /**
+    * @fn void clear()
+    * @brief Supprime le contenu de l'ensemble.
+    */
+    void clear();
+
+    /**
+    * @fn bool contains(const std::string& word) const
+    * @brief Indique si le mot est dans l'ensemble.
+    *
+    * @param[in] word     mot à rechercher
+    *
+    * @return true si le mot est présent, false sinon.
+    */
+    bool contains(const std::string &word) const;
+
+    /**
+    * @fn template <typename Equal>
+    *     bool contains(uint64_t hash, Equal equal) const
+    * @brief Indique si un mot, connu par son empreinte, est dans l'ensemble.
+    *        Le mot n'est comparé qu'à celui de la case de son empreinte, puis
+    *        aux mots de même empreinte gardés à part.
+    *
+    * @param[in] hash      hashWord() du mot recherché
+    * @param[in] equal     equal(data, length) indique si le mot est égal aux
+    *                      caractères de la case
+    *
+    * @return true si le mot est présent, false sinon.
+    */
+    template<typename Equal>
+    bool contains(uint64_t hash, Equal equal) const {
+        if (pilots.empty())
+            return false;
+
+        const size_t SLOT = find(hash);
+        if (equal(letters.data() + offsets[SLOT],
+                  (size_t) (offsets[SLOT + 1] - offsets[SLOT])))
+            return true;
+
+        for (const std::pair<uint64_t, std::string> &collision : collisions)
+            if (collision.first == hash
+                && equal(collision.second.data(), collision.second.length()))
+                return true;
+
+        return false;
+    }
+
+    /**
+    * @fn size_t size() const
+    * @brief Obtient le nombre de mots de l'ensemble.
+    *
+    * @return nombre de mots.
+    */
+    size_t size() const;
+
+    /**
+    * @fn size_t countBuckets() const
+    * @brief Obtient le nombre de paquets, donc de pilotes.
+    *
+    * @return nombre de paquets.
+    */
+    size_t countBuckets() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les pilotes et les mots.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @fn size_t position(uint64_t hash, uint32_t pilot) const
+    * @brief Obtient la case d'une empreinte avec un pilote donné.
+    */
+    size_t position(uint64_t hash, uint32_t pilot) const;
+
+    /**
+    * @fn size_t find(uint64_t hash) const
+    * @brief Obtient la seule case pouvant contenir le mot d'empreinte
+    *        hashWord() donnée. L'ensemble ne doit pas être vide.
+    */
+    size_t find(uint64_t hash) const;
+
+    /**
+    * @var   std::vector<uint32_t> pilots
+    * @brief Pilote de chaque paquet.
+    */
+    std::vector<uint32_t> pilots;
+
+    /**
+    * @var   std::string letters
+    * @brief Lettres des mots à la suite, dans l'ordre de leur case.
+    */
+    std::string letters;
+
+    /**
+    * @var   std::vector<uint32_t> offsets
+    * @brief Position du mot de chaque case dans letters, plus la fin du
+    *        dernier.
+    */
+    std::vector<uint32_t> offsets;
+
+    /**
+    * @var   std::vector<std::pair<uint64_t, std::string>> collisions
+    * @brief Mots dont l'empreinte est celle d'un mot déjà indexé, avec
+    *        cette empreinte.
+    */
+    std::vector<std::pair<uint64_t, std::string>> collisions;
+};
@@ -15,8 +15,12 @@
 #include <algorithm>
 #include <fstream>
 #include <string>
+#include <vector>
 
+#include "BloomFilter.h"
+#include "Candidate.h"
 #include "IDictionary.h"
+#include "ISuggestionEngine.h"
 #include "OutputFile.h"
 #include "Tools.h"
 
@@ -33,7 +37,8 @@ public:
     */
     Spellchecker(IDictionary &dictionary,
                  const std::string &filenameOutput = OUTPUT)
-            : dictionary(&dictionary), output(filenameOutput) {}
+            : dictionary(&dictionary), engine(nullptr), filter(nullptr),
+              output(filenameOutput) {}
 
     /**
     * @fn IDictionary getDictionary() const
@@ -54,17 +59,48 @@ public:
     }
 
     /**
-    * @fn void checkString(const std::string& mistakeType, std::string& word)
-    * @brief Ecris dans le fichier de sortie le type de l'erreur et
-    *        l'orthographe correct du mot si seulement le mot n'est pas
-    *        présent dans le dictionnaire.
+    * @fn ISuggestionEngine* getEngine() const
+    * @brief Obtient le moteur de suggestions utilisé.
     *
-    * @param[in] mistakeType      type d'erreur orthographique
-    * @param[in] word             mot à vérifier l'orthographe
+    * @return moteur de suggestions, nul si les corrections sont générées
+    *         lettre par lettre.
     */
-    void checkString(const std::string &mistakeType, std::string &word) {
-        if (dictionary->contains(word))
-            output << mistakeType << ":" << word << std::endl;
+    ISuggestionEngine *getEngine() const {
+        return engine;
+    }
+
+    /**
+    * @fn void setEngine(ISuggestionEngine* engine)
+    * @brief Définis le moteur de suggestions utilisé. Sans moteur, les
+    *        corrections sont générées lettre par lettre puis recherchées
+    *        dans le dictionnaire.
+    *
+    * @param[in] engine    moteur de suggestions, nul pour aucun
+    */
+    void setEngine(ISuggestionEngine *engine) {
+        this->engine = engine;
+    }
+
+    /**
+    * @fn const BloomFilter* getFilter() const
+    * @brief Obtient le filtre consulté avant le dictionnaire.
+    *
+    * @return filtre des corrections, nul si aucun.
+    */
+    const BloomFilter *getFilter() const {
+        return filter;
+    }
+
+    /**
+    * @fn void setFilter(const BloomFilter* filter)
+    * @brief Définis le filtre consulté avant le dictionnaire pour chaque
+    *        correction essayée. Il doit contenir tous les mots du
+    *        dictionnaire.
+    *
+    * @param[in] filter    filtre des corrections, nul pour aucun
+    */
+    void setFilter(const BloomFilter *filter) {
+        this->filter = filter;
     }
 
     /**
@@ -81,11 +117,11 @@ public:
         const std::string MISTAKE_TYPE = "1";
         const size_t LENGTH = word.length();
 
-        for (size_t i = 0; i < LENGTH; ++i) {
-            std::string subWord = word.substr(0, i) + word.substr(i + 1, LENGTH - i - 1);
+        candidates.prepare(word);
 
+        for (size_t i = 0; i < LENGTH; ++i) {
             // Vérification de l'orthographe
-            checkString(MISTAKE_TYPE, subWord);
+            checkCandidate(MISTAKE_TYPE, candidates.deletion(i));
         }
     }
 
@@ -97,16 +133,18 @@ public:
     *
     * @param[in] word    mot à vérifier l'orthographe
     */
-    void missingLetter(std::string &word) {
+    void missingLetter(const std::string &word) {
         if (word.empty())
             return;
 
         const std::string MISTAKE_TYPE = "2";
+        const size_t LENGTH = word.length();
+
+        candidates.prepare(word);
 
-        for (std::string::iterator it = word.begin(); it != word.end() + 1; ++it) {
-            it = word.insert(it, 'a');
-            replaceByAlphabet(MISTAKE_TYPE, word, it);
-            it = word.erase(it);
+        for (size_t i = 0; i <= LENGTH; ++i) {
+            candidates.insertions(i, batch);
+            checkCandidates(MISTAKE_TYPE, batch, CandidateGenerator::LETTERS);
         }
     }
 
@@ -118,17 +156,18 @@ public:
     *
     * @param[in] word    mot à vérifier l'orthographe
     */
-    void typingError(std::string &word) {
+    void typingError(const std::string &word) {
         if (word.empty())
             return;
 
         const std::string MISTAKE_TYPE = "3";
+        const size_t LENGTH = word.length();
 
-        // Position du caractère qui suit le dernier caractère
-        const std::string::iterator END = word.end();
+        candidates.prepare(word);
 
-        for (std::string::iterator it = word.begin(); it != END; ++it) {
-            replaceByAlphabet(MISTAKE_TYPE, word, it);
+        for (size_t i = 0; i < LENGTH; ++i) {
+            candidates.substitutions(i, batch);
+            checkCandidates(MISTAKE_TYPE, batch, CandidateGenerator::LETTERS);
         }
     }
 
@@ -139,22 +178,18 @@ public:
     *
     * @param[in] word    mot à vérifier l'orthographe
     */
-    void letterSwap(std::string &word) {
+    void letterSwap(const std::string &word) {
         if (word.empty())
             return;
 
         const std::string MISTAKE_TYPE = "4";
+        const size_t LENGTH = word.length();
 
-        // Position du dernier caractère à échanger
-        const std::string::iterator END = word.end() - 1;
-
-        for (std::string::iterator it = word.begin(); it != END; ++it) {
-            std::swap(*it, *(it + 1));
+        candidates.prepare(word);
 
+        for (size_t i = 0; i + 1 < LENGTH; ++i) {
             // Vérification de l'orthographe
-            checkString(MISTAKE_TYPE, word);
-
-            std::swap(*it, *(it + 1));
+            checkCandidate(MISTAKE_TYPE, candidates.transposition(i));
         }
     }
 
@@ -197,6 +232,11 @@ public:
                     // Chaîne de caractères mal orthographié
                     output << "*" << word << std::endl;
 
+                    if (engine) {
+                        suggest(word);
+                        continue;
+                    }
+
                     // Suppression d'une lettre du mot
                     extraLetter(word);
 
@@ -233,28 +273,82 @@ public:
 
 private:
     /**
-    * @fn void replaceByAlphabet(const std::string& mistakeType,
-    *                            std::string& word,
-    *                            const std::string::iterator& it)
-    * @brief Ecris dans le fichier de sortie toutes les erreurs et corrections
-    *        orthographiques d'un texte.
+    * @fn void suggest(const std::string& word)
+    * @brief Ecris dans le fichier de sortie les corrections du mot obtenues
+    *        par le moteur de suggestions.
+    *
+    * @param[in] word    mot mal orthographié
+    */
+    void suggest(const std::string &word) {
+        corrections.clear();
+        engine->suggest(word, corrections);
+
+        // La distance n'est écrite que pour les corrections à plus d'une
+        // erreur, les autres gardent le format des corrections générées.
+        for (const Correction &correction : corrections) {
+            output << correction.type << ":" << correction.word;
+
+            if (correction.distance > 1)
+                output << ":" << correction.distance;
+
+            output << std::endl;
+        }
+    }
+
+    /**
+    * @fn void checkCandidate(const std::string& mistakeType,
+    *                         const Candidate& candidate)
+    * @brief Ecris dans le fichier de sortie le type de l'erreur et le
+    *        candidat si il est présent dans le dictionnaire. Le filtre et le
+    *        dictionnaire sont consultés avec l'empreinte du candidat, qui
+    *        n'est construit que pour être écrit.
     *
     * @param[in] mistakeType   type d'erreur orthographique
-    * @param[in] word          mot à vérifier l'orthographe
-    * @param[in] it            pointeur sur un caractère du mot
+    * @param[in] candidate     candidat à vérifier
     */
-    void replaceByAlphabet(const std::string &mistakeType, std::string &word,
-                           const std::string::iterator &it) {
-        const char OLD_CHAR = *it;
+    void checkCandidate(const std::string &mistakeType, const Candidate &candidate) {
+        if ((!filter || filter->mayContain(candidate.hash))
+            && dictionary->containsCandidate(candidate))
+            output << mistakeType << ":" << candidate.str() << std::endl;
+    }
 
-        for (char c = 'a'; c <= 'z'; ++c) {
-            *it = c;
+    /**
+    * @fn void checkCandidates(const std::string& mistakeType,
+    *                          const Candidate* candidates, size_t count)
+    * @brief Ecris dans le fichier de sortie le type de l'erreur et chaque
+    *        candidat d'un lot présent dans le dictionnaire, dans l'ordre du
+    *        lot. Les candidats retenus par le filtre sont recherchés
+    *        ensemble.
+    *
+    * @param[in] mistakeType   type d'erreur orthographique
+    * @param[in] candidates    candidats à vérifier, au plus LETTERS
+    * @param[in] count         nombre de candidats
+    */
+    void checkCandidates(const std::string &mistakeType, const Candidate *candidates,
+                         size_t count) {
+        bool found[CandidateGenerator::LETTERS];
+        Candidate kept[CandidateGenerator::LETTERS];
 
-            // Vérification de l'orthographe
-            checkString(mistakeType, word);
+        // Seuls les candidats que le filtre ne rejette pas sont recherchés.
+        if (filter) {
+            size_t keptCount = 0;
+
+            for (size_t i = 0; i < count; ++i)
+                filter->prefetch(candidates[i].hash);
+
+            for (size_t i = 0; i < count; ++i)
+                if (filter->mayContain(candidates[i].hash))
+                    kept[keptCount++] = candidates[i];
+
+            candidates = kept;
+            count = keptCount;
         }
 
-        *it = OLD_CHAR;
+        dictionary->containsCandidates(candidates, count, found);
+
+        for (size_t i = 0; i < count; ++i)
+            if (found[i])
+                output << mistakeType << ":" << candidates[i].str() << std::endl;
     }
 
     /**
@@ -263,6 +357,36 @@ private:
     */
     IDictionary *dictionary;
 
+    /**
+    * @var   ISuggestionEngine* engine
+    * @brief Moteur de suggestions, nul pour générer les corrections.
+    */
+    ISuggestionEngine *engine;
+
+    /**
+    * @var   const BloomFilter* filter
+    * @brief Filtre consulté avant le dictionnaire, nul pour aucun.
+    */
+    const BloomFilter *filter;
+
+    /**
+    * @var   std::vector<Correction> corrections
+    * @brief Corrections du dernier mot, gardées pour réutiliser la mémoire.
+    */
+    std::vector<Correction> corrections;
+
+    /**
+    * @var   CandidateGenerator candidates
+    * @brief Empreintes des préfixes du mot en cours de correction.
+    */
+    CandidateGenerator candidates;
+
+    /**
+    * @var   Candidate batch[CandidateGenerator::LETTERS]
+    * @brief Candidats d'une position, vérifiés ensemble.
+    */
+    Candidate batch[CandidateGenerator::LETTERS];
+
     /**
     * @var   OutputFile output
     * @brief Fichier de sortie des corrections orthographiques.
@@ -0,0 +1,106 @@
+/**
+*  @file StringPool.h
+*  @brief Modélise un pool de caractères où les chaînes sont ajoutées à la
+*         suite et ne bougent plus.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+template<size_t CHUNK_SIZE = 65536>
+class StringPool {
+public:
+    /**
+    * @fn StringPool()
+    * @brief Constructeur d'un pool vide. Aucun bloc n'est alloué avant le
+    *        premier ajout.
+    */
+    StringPool() : used(CHUNK_SIZE), chunkSize(CHUNK_SIZE), bytes(0) {}
+
+    StringPool(const StringPool &) = delete;
+
+    StringPool &operator=(const StringPool &) = delete;
+
+    /**
+    * @fn std::string_view append(std::string_view str)
+    * @brief Copie une chaîne à la suite des précédentes. Les blocs ne sont
+    *        jamais réalloués, la vue reste valide jusqu'à clear().
+    *
+    * @param[in] str    chaîne à copier
+    *
+    * @return vue sur la copie.
+    */
+    std::string_view append(std::string_view str) {
+        if (str.empty())
+            return std::string_view();
+
+        // Une chaîne plus grande qu'un bloc a son propre bloc.
+        if (used + str.size() > chunkSize) {
+            chunkSize = std::max(CHUNK_SIZE, str.size());
+            chunks.emplace_back(new char[chunkSize]);
+            bytes += chunkSize;
+            used = 0;
+        }
+
+        char *copy = chunks.back().get() + used;
+        std::memcpy(copy, str.data(), str.size());
+        used += str.size();
+
+        return std::string_view(copy, str.size());
+    }
+
+    /**
+    * @fn void clear()
+    * @brief Libère tous les blocs. Les vues obtenues auparavant deviennent
+    *        invalides.
+    */
+    void clear() {
+        chunks.clear();
+        used = chunkSize = CHUNK_SIZE;
+        bytes = 0;
+    }
+
+    /**
+    * @fn size_t capacity() const
+    * @brief Obtient le nombre d'octets réservés par les blocs.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t capacity() const {
+        return bytes;
+    }
+
+private:
+    /**
+    * @var   std::vector<std::unique_ptr<char[]>> chunks
+    * @brief Blocs de caractères, le dernier reçoit les ajouts.
+    */
+    std::vector<std::unique_ptr<char[]>> chunks;
+
+    /**
+    * @var   size_t used
+    * @brief Nombre d'octets déjà utilisés dans le dernier bloc.
+    */
+    size_t used;
+
+    /**
+    * @var   size_t chunkSize
+    * @brief Taille du dernier bloc.
+    */
+    size_t chunkSize;
+
+    /**
+    * @var   size_t bytes
+    * @brief Somme des tailles des blocs.
+    */
+    size_t bytes;
+};
@@ -0,0 +1,212 @@
+/**
+*  @file SymSpellEngine.cpp
+*  @brief Modélise un moteur de suggestions par suppressions symétriques
+*         (SymSpell) : chaque mot du dictionnaire est indexé sous les
+*         chaînes obtenues en lui retirant une lettre.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "Candidate.h"
+#include "SymSpellEngine.h"
+#include "Tools.h"
+
+namespace {
+    /**
+    * @fn bool isLetter(char c)
+    * @brief Indique si le caractère fait partie de l'alphabet essayé par le
+    *        correcteur orthographique.
+    */
+    bool isLetter(char c) {
+        return c >= 'a' && c <= 'z';
+    }
+}
+
+SymSpellEngine::SymSpellEngine(const std::string &filename) {
+    std::vector<std::string> words(loadSortedWords(filename));
+
+    build(words);
+}
+
+void SymSpellEngine::build(const std::vector<std::string> &words) {
+    // Empreinte de chaque clé avec le numéro du mot indexé
+    std::vector<std::pair<uint64_t, uint32_t>> entries;
+    std::vector<uint64_t> keys;
+    CandidateGenerator generator;
+
+    starts.assign(1, 0);
+
+    for (uint32_t id = 0; id < words.size(); ++id) {
+        const std::string &word = words[id];
+        const size_t LENGTH = word.length();
+
+        letters += word;
+        starts.push_back((uint32_t) letters.size());
+
+        // Le mot lui-même et chacune de ses suppressions, une seule fois
+        // chacune pour les lettres doublées.
+        generator.prepare(word);
+        keys.assign(1, hashWord(word.data(), LENGTH));
+
+        for (size_t i = 0; i < LENGTH; ++i)
+            keys.push_back(generator.deletion(i).hash);
+
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        for (uint64_t key : keys)
+            entries.emplace_back(key, id);
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    // Nombre de clés distinctes
+    size_t keyCount = 0;
+    for (size_t i = 0; i < entries.size(); ++i)
+        if (i == 0 || entries[i].first != entries[i - 1].first)
+            ++keyCount;
+
+    // Table remplie aux quatre cinquièmes au plus
+    size_t capacity = 1;
+    while (capacity * 4 < keyCount * 5)
+        capacity <<= 1;
+
+    slots.assign(capacity, Slot{0, 0});
+    hashes.clear();
+    hashes.reserve(keyCount);
+    offsets.clear();
+    offsets.reserve(keyCount + 1);
+    postings.clear();
+    postings.reserve(entries.size());
+
+    const size_t MASK = capacity - 1;
+
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const uint64_t hash = entries[i].first;
+
+        if (i == 0 || hash != entries[i - 1].first) {
+            size_t slot = hash & MASK;
+            while (slots[slot].key)
+                slot = (slot + 1) & MASK;
+
+            hashes.push_back(hash);
+            offsets.push_back((uint32_t) postings.size());
+            slots[slot] = Slot{(uint32_t) (hash >> 32), (uint32_t) offsets.size()};
+        }
+
+        postings.push_back(entries[i].second);
+    }
+
+    offsets.push_back((uint32_t) postings.size());
+
+    letters.shrink_to_fit();
+    starts.shrink_to_fit();
+}
+
+const uint32_t *SymSpellEngine::find(uint64_t hash, const uint32_t *&end) const {
+    const size_t MASK = slots.size() - 1;
+    const uint32_t CHECK = (uint32_t) (hash >> 32);
+
+    // Une case dont seuls les bits de poids fort concordent peut appartenir
+    // à une autre clé : la recherche continue jusqu'à l'empreinte entière.
+    for (size_t slot = hash & MASK; slots[slot].key; slot = (slot + 1) & MASK)
+        if (slots[slot].check == CHECK && hashes[slots[slot].key - 1] == hash) {
+            const uint32_t key = slots[slot].key - 1;
+            end = postings.data() + offsets[key + 1];
+            return postings.data() + offsets[key];
+        }
+
+    end = nullptr;
+    return nullptr;
+}
+
+void SymSpellEngine::suggest(const std::string &word,
+                             std::vector<Correction> &corrections) {
+    const size_t LENGTH = word.length();
+    if (LENGTH == 0)
+        return;
+
+    const char *w = word.data();
+    const size_t FIRST = corrections.size();
+
+    CandidateGenerator generator;
+    generator.prepare(word);
+
+    const uint32_t *end;
+
+    // Lettre manquante : mots plus longs d'une lettre, indexés sous le mot.
+    for (const uint32_t *it = find(hashWord(w, LENGTH), end); it != end; ++it) {
+        const char *u = letters.data() + starts[*it];
+        if (starts[*it + 1] - starts[*it] != LENGTH + 1)
+            continue;
+
+        // La lettre peut être insérée à chaque position entre la fin du
+        // préfixe commun et le début du suffixe commun.
+        size_t prefix = 0;
+        while (prefix < LENGTH && u[prefix] == w[prefix])
+            ++prefix;
+
+        size_t suffix = 0;
+        while (suffix < LENGTH && u[LENGTH - suffix] == w[LENGTH - 1 - suffix])
+            ++suffix;
+
+        for (size_t i = LENGTH - suffix; i <= prefix; ++i)
+            if (isLetter(u[i]))
+                corrections.push_back(Correction{2, i, u[i], std::string(u, LENGTH + 1)});
+    }
+
+    // Les autres corrections sont indexées sous une suppression du mot.
+    for (size_t i = 0; i < LENGTH; ++i) {
+        const uint64_t hash = generator.deletion(i).hash;
+
+        for (const uint32_t *it = find(hash, end); it != end; ++it) {
+            const char *u = letters.data() + starts[*it];
+            const size_t length = starts[*it + 1] - starts[*it];
+
+            if (std::memcmp(u, w, i) != 0)
+                continue;
+
+            // Lettre en trop : la suppression elle-même
+            if (length == LENGTH - 1) {
+                if (std::memcmp(u + i, w + i + 1, LENGTH - i - 1) == 0)
+                    corrections.push_back(Correction{1, i, 0, std::string(u, length)});
+                continue;
+            }
+
+            if (length != LENGTH)
+                continue;
+
+            // Lettre erronée : seule la lettre supprimée diffère
+            if (u[i] != w[i] && isLetter(u[i])
+                && std::memcmp(u + i + 1, w + i + 1, LENGTH - i - 1) == 0)
+                corrections.push_back(Correction{3, i, u[i], std::string(u, length)});
+
+            // Lettres inversées : la suivante a été supprimée du mot inversé
+            if (i + 1 < LENGTH && w[i] != w[i + 1] && u[i] == w[i + 1]
+                && u[i + 1] == w[i]
+                && std::memcmp(u + i + 2, w + i + 2, LENGTH - i - 2) == 0)
+                corrections.push_back(Correction{4, i, 0, std::string(u, length)});
+        }
+    }
+
+    std::sort(corrections.begin() + FIRST, corrections.end());
+}
+
+size_t SymSpellEngine::countKeys() const {
+    return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+size_t SymSpellEngine::memoryUsage() const {
+    return letters.capacity()
+           + starts.capacity() * sizeof(uint32_t)
+           + slots.capacity() * sizeof(Slot)
+           + hashes.capacity() * sizeof(uint64_t)
+           + offsets.capacity() * sizeof(uint32_t)
+           + postings.capacity() * sizeof(uint32_t);
+}
@@ -0,0 +1,137 @@
+/**
+*  @file SymSpellEngine.h
+*  @brief Modélise un moteur de suggestions par suppressions symétriques
+*         (SymSpell) : chaque mot du dictionnaire est indexé sous les
+*         chaînes obtenues en lui retirant une lettre.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ISuggestionEngine.h"
+
+/**
+* Deux mots à distance d'édition 1 ont une suppression en commun : le mot
+* plus court lui-même pour un ajout ou un retrait de lettre, le mot privé de
+* la lettre erronée pour une substitution et le mot privé d'une des deux
+* lettres pour une inversion. Les corrections d'un mot de longueur n sont
+* donc toutes dans les n + 1 listes de l'index désignées par le mot et ses n
+* suppressions.
+*
+* L'index ne conserve que l'empreinte des clés. Les listes sont stockées à la
+* suite dans un seul tableau (format CSR) et chaque candidat est vérifié
+* contre le mot, une collision d'empreintes n'ajoute donc aucune correction.
+*/
+class SymSpellEngine : public ISuggestionEngine {
+public:
+    /**
+    * @fn SymSpellEngine(const std::string& filename)
+    * @brief Constructeur du moteur avec le nom du fichier du dictionnaire.
+    *        Les mots ajoutés ou supprimés du dictionnaire par la suite ne
+    *        sont pas pris en compte.
+    *
+    * @param[in] filename      nom du fichier du dictionnaire
+    */
+    SymSpellEngine(const std::string &filename);
+
+    /**
+    * @fn void suggest(const std::string& word,
+    *                  std::vector<Correction>& corrections)
+    * @brief Ajoute les corrections du mot à distance d'édition 1, dans
+    *        l'ordre de Correction.
+    *
+    * @param[in] word           mot mal orthographié, nettoyé
+    * @param[out] corrections   tableau auquel ajouter les corrections
+    */
+    void suggest(const std::string &word, std::vector<Correction> &corrections);
+
+    /**
+    * @fn size_t countKeys() const
+    * @brief Obtient le nombre de clés distinctes de l'index.
+    *
+    * @return nombre de clés.
+    */
+    size_t countKeys() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée par les mots et l'index.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @var   struct Slot
+    * @brief Case de la table de hachage des clés.
+    */
+    struct Slot {
+        uint32_t check; // bits de poids fort de l'empreinte
+        uint32_t key;   // numéro de la clé plus 1, 0 pour une case libre
+    };
+
+    /**
+    * @fn void build(const std::vector<std::string>& words)
+    * @brief Construit l'index des mots.
+    *
+    * @param[in] words     mots triés, sans doublon ni mot vide
+    */
+    void build(const std::vector<std::string> &words);
+
+    /**
+    * @fn const uint32_t* find(uint64_t hash, const uint32_t*& end) const
+    * @brief Obtient la liste des mots indexés sous une empreinte.
+    *
+    * @param[in] hash    empreinte de la clé
+    * @param[out] end    fin de la liste
+    *
+    * @return début de la liste, vide si la clé est absente.
+    */
+    const uint32_t *find(uint64_t hash, const uint32_t *&end) const;
+
+    /**
+    * @var   std::string letters
+    * @brief Lettres de tous les mots, à la suite.
+    */
+    std::string letters;
+
+    /**
+    * @var   std::vector<uint32_t> starts
+    * @brief Position de chaque mot dans letters, plus la fin du dernier.
+    */
+    std::vector<uint32_t> starts;
+
+    /**
+    * @var   std::vector<Slot> slots
+    * @brief Table de hachage des clés, à adressage ouvert.
+    */
+    std::vector<Slot> slots;
+
+    /**
+    * @var   std::vector<uint64_t> hashes
+    * @brief Empreinte entière de chaque clé, consultée quand les bits de
+    *        poids fort d'une case concordent.
+    */
+    std::vector<uint64_t> hashes;
+
+    /**
+    * @var   std::vector<uint32_t> offsets
+    * @brief Début de la liste de chaque clé dans postings, plus la fin de la
+    *        dernière.
+    */
+    std::vector<uint32_t> offsets;
+
+    /**
+    * @var   std::vector<uint32_t> postings
+    * @brief Numéros des mots de chaque clé, liste après liste.
+    */
+    std::vector<uint32_t> postings;
+};
@@ -11,16 +11,29 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "MemoryPool.h"
+
 template<typename ValueType>
 class TernarySearchTree {
+private:
+    struct Node;
+
 public:
+    /**
+    * @typedef const Node* Handle
+    * @brief Référence en lecture vers un noeud de l'arbre. Handle() désigne
+    *        un sous-arbre vide.
+    */
+    typedef const Node *Handle;
+
     /**
     * @fn TernarySearchTree()
     * @brief Constructeur d'un arbre ternaire de recherche.
     */
-    TernarySearchTree() : root(nullptr) {}
+    TernarySearchTree() : root(nullptr), keys(0) {}
 
     /**
     * @fn ~TernarySearchTree()
@@ -30,6 +43,10 @@ public:
         clear();
     }
 
+    TernarySearchTree(const TernarySearchTree &) = delete;
+
+    TernarySearchTree &operator=(const TernarySearchTree &) = delete;
+
     /**
     * @fn std::vector<std::string>& allKeys(std::vector<std::string>& keys) const
     * @brief Obtient toutes les clés de l'arbre ternaire de recherche.
@@ -72,27 +89,44 @@ public:
 
     /**
     * @fn void clear()
-    * @brief Supprime le contenu de l'arbre ternaire de recherche.
+    * @brief Supprime le contenu de l'arbre ternaire de recherche. Tous les
+    *        noeuds sont libérés d'un coup avec les blocs du pool.
     */
     void clear() {
-        visitInOrder([](char c, ValueType &value) {
-            value = (ValueType) NULL;
-        });
-
-        root = removeSubTree(root);
+        root = nullptr;
+        keys = 0;
+        pool.clear();
     }
 
     /**
     * @fn size_t countKeys() const
     * @brief Obtient le nombre de clés contenues dans l'arbre ternaire de
-    *        recherche.
-    *
-    * @param[in] key     clé à rechercher
+    *        recherche, tenu à jour par put et remove.
     *
     * @return nombre de clés contenues dans l'arbre ternaire de recherche.
     */
     size_t countKeys() const {
-        return countKeys(root);
+        return keys;
+    }
+
+    /**
+    * @fn size_t countNodes() const
+    * @brief Obtient le nombre de noeuds de l'arbre ternaire de recherche.
+    *
+    * @return nombre de noeuds de l'arbre ternaire de recherche.
+    */
+    size_t countNodes() const {
+        return countNodes(root);
+    }
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire réservée pour les noeuds de l'arbre.
+    *
+    * @return nombre d'octets réservés.
+    */
+    size_t memoryUsage() const {
+        return pool.capacity() * sizeof(Node);
     }
 
     /**
@@ -114,6 +148,77 @@ public:
         return node->value;
     }
 
+    /**
+    * @fn Handle getRoot() const
+    * @brief Obtient la racine de l'arbre ternaire de recherche.
+    *
+    * @return racine de l'arbre, Handle() si l'arbre est vide.
+    */
+    Handle getRoot() const {
+        return root;
+    }
+
+    /**
+    * @fn Handle getLeft(Handle node) const
+    * @brief Obtient le sous-arbre des caractères plus petits du noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return sous-arbre gauche du noeud.
+    */
+    Handle getLeft(Handle node) const {
+        return node->left;
+    }
+
+    /**
+    * @fn Handle getMiddle(Handle node) const
+    * @brief Obtient le sous-arbre des caractères suivant celui du noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return sous-arbre central du noeud.
+    */
+    Handle getMiddle(Handle node) const {
+        return node->middle;
+    }
+
+    /**
+    * @fn Handle getRight(Handle node) const
+    * @brief Obtient le sous-arbre des caractères plus grands du noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return sous-arbre droit du noeud.
+    */
+    Handle getRight(Handle node) const {
+        return node->right;
+    }
+
+    /**
+    * @fn char getChar(Handle node) const
+    * @brief Obtient le caractère du noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return caractère du noeud.
+    */
+    char getChar(Handle node) const {
+        return node->c;
+    }
+
+    /**
+    * @fn ValueType getValue(Handle node) const
+    * @brief Obtient la valeur du noeud, (ValueType) NULL si aucune clé ne
+    *        se termine sur ce noeud.
+    *
+    * @param[in] node    noeud non vide de l'arbre
+    *
+    * @return valeur du noeud.
+    */
+    ValueType getValue(Handle node) const {
+        return node->value;
+    }
+
     /**
     * @fn size_t height() const
     * @brief Obtient la hauteur de l'arbre ternaire de recherche.
@@ -135,22 +240,48 @@ public:
 
     /**
     * @fn size_t remove(const std::string& key)
-    * @brief Obtient la hauteur de l'arbre ternaire de recherche.
+    * @brief Supprime la clé de l'arbre ternaire de recherche. Seuls les
+    *        noeuds du chemin de la clé devenus inutiles sont libérés.
     *
-    * @return hauteur de l'arbre ternaire de recherche.
+    * @return nombre de clés supprimées.
     */
     size_t remove(const std::string &key) {
         if (key.empty())
             return 0;
 
-        Node *node = get(root, key, 0);
-        if (!node)
-            return 0;
-
-        node->value = (ValueType) NULL;
-        root = removeSubTree(root);
+        const char *k = key.data();
+        const size_t LAST = key.length() - 1;
+        size_t charIndex = 0;
+
+        // Liens suivis depuis la racine jusqu'au noeud de la clé
+        std::vector<Node **> path;
+        Node **link = &root;
+
+        while (*link) {
+            Node *x = *link;
+            const char c = k[charIndex];
+            path.push_back(link);
+
+            if (c < x->c)
+                link = &x->left;
+            else if (c > x->c)
+                link = &x->right;
+            else if (charIndex < LAST) {
+                link = &x->middle;
+                ++charIndex;
+            } else {
+                if (!x->value)
+                    return 0;
+
+                x->value = (ValueType) NULL;
+                --keys;
+                prune(path);
+
+                return 1;
+            }
+        }
 
-        return 1;
+        return 0;
     }
 
     /**
@@ -185,52 +316,104 @@ private:
     */
     Node *root;
 
+    /**
+    * @var   size_t keys
+    * @brief Nombre de clés de l'arbre.
+    */
+    size_t keys;
+
+    /**
+    * @var   MemoryPool<Node> pool
+    * @brief Pool dans lequel sont alloués les noeuds de l'arbre.
+    */
+    MemoryPool<Node> pool;
+
     /**
     * @fn void collect(Node* node, std::string prefix,
     *                  std::vector<std::string>& keys) const
     * @brief Rempli le tableau de toutes clés contenues dans l'arbre ternaire
-    *        de recherche.
+    *        de recherche. Chaque noeud est ajouté après ses sous-arbres
+    *        gauche, central et droit.
     */
     void collect(Node *node, std::string prefix,
                  std::vector<std::string> &keys) const {
-        if (!node)
-            return;
-
-        if (node->left)
-            collect(node->left, prefix, keys);
-        if (node->middle)
-            collect(node->middle, prefix + std::string(1, node->c), keys);
-        if (node->right)
-            collect(node->right, prefix, keys);
-
-        if (node->value && !prefix.empty())
-            keys.push_back(prefix + std::string(1, node->c));
+        // Etape de la visite d'un noeud : ses trois sous-arbres, puis lui-même
+        enum Stage {
+            LEFT, MIDDLE, RIGHT, SELF
+        };
+
+        struct Frame {
+            Node *node;
+            size_t depth;
+            Stage stage;
+        };
+
+        const size_t START = prefix.length();
+        std::vector<Frame> stack;
+
+        if (node)
+            stack.push_back(Frame{node, START, LEFT});
+
+        while (!stack.empty()) {
+            Frame &frame = stack.back();
+            node = frame.node;
+            const size_t depth = frame.depth;
+
+            switch (frame.stage) {
+                case LEFT:
+                    frame.stage = MIDDLE;
+                    if (node->left)
+                        stack.push_back(Frame{node->left, depth, LEFT});
+                    break;
+
+                case MIDDLE:
+                    frame.stage = RIGHT;
+                    if (node->middle) {
+                        prefix.resize(depth);
+                        prefix.push_back(node->c);
+                        stack.push_back(Frame{node->middle, depth + 1, LEFT});
+                    }
+                    break;
+
+                case RIGHT:
+                    frame.stage = SELF;
+                    if (node->right)
+                        stack.push_back(Frame{node->right, depth, LEFT});
+                    break;
+
+                case SELF:
+                    if (node->value && depth) {
+                        prefix.resize(depth);
+                        keys.push_back(prefix + std::string(1, node->c));
+                    }
+                    stack.pop_back();
+                    break;
+            }
+        }
     }
 
     /**
-    * @fn size_t countKeys(Node* node) const
-    * @brief Obtient le nombre de clés contenues dans l'arbre ternaire de
-    *        recherche.
+    * @fn size_t countNodes(Node* node) const
+    * @brief Obtient le nombre de noeuds du sous-arbre.
     *
     * @param[in] node    noeud de l'arbre ternaire de recherche
     *
-    * @return nombre de clés contenues dans l'arbre ternaire de recherche.
+    * @return nombre de noeuds du sous-arbre.
     */
-    size_t countKeys(Node *node) const {
+    size_t countNodes(Node *node) const {
         size_t counter = 0;
 
-        if (!node)
-            return counter;
-        else if (node->value)
-            counter = 1;
+        visit(node, [&](Node *) {
+            ++counter;
+        });
 
-        return counter + countKeys(node->left) + countKeys(node->middle)
-               + countKeys(node->right);
+        return counter;
     }
 
     /**
     * @fn Node* get(Node* node, const std::string& key, size_t charIndex) const
-    * @brief Obtient le noeud recherché de l'arbre ternaire de recherche.
+    * @brief Obtient le noeud recherché de l'arbre ternaire de recherche. La
+    *        clé ne doit pas être vide.
     *
     * @param[in] node          noeud de l'arbre ternaire de recherche
     * @param[in] key           clé du noeud recherché
@@ -239,19 +422,24 @@ private:
     * @return noeud recherché de l'arbre ternaire de recherche.
     */
     Node *get(Node *node, const std::string &key, size_t charIndex) const {
-        if (!node)
-            return nullptr;
-
-        char c = key.at(charIndex);
-
-        if (c < node->c)
-            return get(node->left, key, charIndex);
-        else if (c > node->c)
-            return get(node->right, key, charIndex);
-        else if (charIndex < key.length() - 1)
-            return get(node->middle, key, charIndex + 1);
-        else
-            return node;
+        const char *k = key.data();
+        const size_t LAST = key.length() - 1;
+
+        while (node) {
+            const char c = k[charIndex];
+
+            if (c < node->c)
+                node = node->left;
+            else if (c > node->c)
+                node = node->right;
+            else if (charIndex < LAST) {
+                node = node->middle;
+                ++charIndex;
+            } else
+                return node;
+        }
+
+        return nullptr;
     }
 
     /**
@@ -263,68 +451,121 @@ private:
     * @return hauteur de l'arbre ternaire de recherche.
     */
     size_t height(Node *node) const {
-        if (!node)
-            return 0;
+        size_t maxLevel = 0;
+        std::vector<std::pair<Node *, size_t>> stack;
+
+        if (node)
+            stack.emplace_back(node, 1);
+
+        while (!stack.empty()) {
+            node = stack.back().first;
+            const size_t level = stack.back().second;
+            stack.pop_back();
+
+            maxLevel = std::max(maxLevel, level);
 
-        return std::max({height(node->left), height(node->middle),
-                         height(node->right)}) + 1;
+            for (Node *child : {node->left, node->middle, node->right})
+                if (child)
+                    stack.emplace_back(child, level + 1);
+        }
+
+        return maxLevel;
     }
 
     /**
     * @fn Node* put(Node* node, const std::string& key, const ValueType& value,
     *               size_t charIndex)
-    * @brief Ajoute une clé et une valeur à l'arbre ternaire de recherche.
+    * @brief Ajoute une clé et une valeur à l'arbre ternaire de recherche. La
+    *        clé ne doit pas être vide.
     *
     * @param[in] node          noeud de l'arbre ternaire de recherche
     * @param[in] key           clé du noeud recherché
     * @param[in] charIndex     index de la partie de la clé
     *
-    * @return noeud ajouté de l'arbre ternaire de recherche.
+    * @return racine du sous-arbre, créée si node est nul.
     */
     Node *put(Node *node, const std::string &key, const ValueType &value,
               size_t charIndex) {
-        char c = key.at(charIndex);
-
-        if (!node) {
-            node = new Node();
-            node->c = c;
+        const char *k = key.data();
+        const size_t LAST = key.length() - 1;
+
+        // Lien à suivre, puis à remplir si le noeud n'existe pas
+        Node **link = &node;
+
+        while (true) {
+            const char c = k[charIndex];
+            Node *x = *link;
+
+            if (!x) {
+                x = *link = pool.allocate();
+                x->c = c;
+            }
+
+            if (c < x->c)
+                link = &x->left;
+            else if (c > x->c)
+                link = &x->right;
+            else if (charIndex < LAST) {
+                link = &x->middle;
+                ++charIndex;
+            } else {
+                if (!x->value && value)
+                    ++keys;
+                else if (x->value && !value)
+                    --keys;
+
+                x->value = value;
+                return node;
+            }
         }
+    }
 
-        if (c < node->c)
-            node->left = put(node->left, key, value, charIndex);
-        else if (c > node->c)
-            node->right = put(node->right, key, value, charIndex);
-        else if (charIndex < key.length() - 1)
-            node->middle = put(node->middle, key, value, charIndex + 1);
-        else
-            node->value = value;
+    /**
+    * @fn void prune(const std::vector<Node**>& path)
+    * @brief Libère, du bas vers le haut, les noeuds du chemin qui ne portent
+    *        plus ni valeur ni sous-arbre central. Un noeud libéré est
+    *        remplacé par ses sous-arbres gauche et droit.
+    *
+    * @param[in] path    liens de la racine jusqu'au noeud d'une clé
+    */
+    void prune(const std::vector<Node **> &path) {
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            Node *x = **it;
 
-        return node;
+            if (x->value || x->middle)
+                break;
+
+            **it = detach(x);
+            pool.deallocate(x);
+        }
     }
 
     /**
-    * @fn Node* removeSubTree(Node* node)
-    * @brief Supprime un noeud à l'arbre ternaire de recherche.
+    * @fn Node* detach(Node* node)
+    * @brief Réunit les sous-arbres gauche et droit d'un noeud à retirer. Le
+    *        plus grand noeud du sous-arbre gauche prend sa place.
     *
-    * @param[in] node    noeud de l'arbre ternaire de recherche
+    * @param[in] node    noeud à retirer
     *
-    * @return noeud supprimé de l'arbre ternaire de recherche.
+    * @return racine du sous-arbre remplaçant le noeud.
     */
-    Node *removeSubTree(Node *node) {
-        if (!node)
-            return nullptr;
-
-        if (node->left)
-            node->left = removeSubTree(node->left);
-        if (node->middle)
-            node->middle = removeSubTree(node->middle);
-        if (node->right)
-            node->right = removeSubTree(node->right);
-
-        if (node->left || node->middle || node->right || node->value)
-            return node;
-        else
-            return nullptr;
+    Node *detach(Node *node) {
+        if (!node->left)
+            return node->right;
+
+        if (!node->right)
+            return node->left;
+
+        Node **link = &node->left;
+        while ((*link)->right)
+            link = &(*link)->right;
+
+        Node *max = *link;
+        *link = max->left;
+        max->left = node->left;
+        max->right = node->right;
+
+        return max;
     }
 
     /**
@@ -337,16 +578,38 @@ private:
     */
     template<typename Function>
     void visitInOrder(Node *node, Function f) {
-        if (!node)
-            return;
+        visit(node, [&](Node *x) {
+            f(x->c, x->value);
+        });
+    }
+
+    /**
+    * @fn template <typename Function>
+    *     void visit(Node* node, Function f) const
+    * @brief Applique la fonction à chaque noeud du sous-arbre, dans l'ordre
+    *        noeud, sous-arbre gauche, central puis droit.
+    *
+    * @param[in] node    noeud de l'arbre ternaire de recherche
+    */
+    template<typename Function>
+    void visit(Node *node, Function f) const {
+        std::vector<Node *> stack;
 
-        f(node->c, node->value);
+        if (node)
+            stack.push_back(node);
 
-        if (node->left)
-            visitInOrder(node->left, f);
-        if (node->middle)
-            visitInOrder(node->middle, f);
-        if (node->right)
-            visitInOrder(node->right, f);
+        while (!stack.empty()) {
+            node = stack.back();
+            stack.pop_back();
+
+            f(node);
+
+            if (node->right)
+                stack.push_back(node->right);
+            if (node->middle)
+                stack.push_back(node->middle);
+            if (node->left)
+                stack.push_back(node->left);
+        }
     }
 };
\ No newline at end of file
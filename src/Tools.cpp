@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <fstream>
 #include <iostream>
 #include <unistd.h>
 
@@ -23,17 +24,48 @@
 // Option pour indiquer un fichier de destination des corrections.
 #define OPTION_O 'o'
 
+// Option pour indiquer le dossier des dictionnaires compilés.
+#define OPTION_C 'c'
+
+// Option pour indiquer les types de dictionnaire à utiliser.
+#define OPTION_B 'b'
+
+// Option pour indiquer le moteur de suggestions.
+#define OPTION_S 's'
+
+// Option pour indiquer le taux de faux positifs du filtre des corrections.
+#define OPTION_F 'f'
+
+// Option pour indiquer la distance d'édition maximale des corrections.
+#define OPTION_K 'k'
+
 // Options permises par l'exécution.
-#define ALL_OPTIONS    "d:i:o:"
+#define ALL_OPTIONS    "d:i:o:c:b:s:f:k:"
 
 // Fichiers par défaut
 #define DICTIONARY "resources/dictionary.txt"
 #define INPUT      "resources/input_sh.txt"
 #define OUTPUT     "output.txt"
+#define CACHE      ""
+
+// Types de dictionnaire par défaut, vide pour tous
+#define BACKENDS   ""
+
+// Moteur de suggestions par défaut
+#define ENGINE     "generate"
+
+// Taux de faux positifs du filtre par défaut, vide pour aucun filtre
+#define FILTER     ""
+
+// Distance d'édition maximale des corrections par défaut
+#define DISTANCE   "1"
+
+// Nombre d'arguments retournés.
+#define ARGUMENTS 8
 
 std::vector<std::string> &parseCmdline(int argc, char *argv[],
                                        std::vector<std::string> &filenames) {
-    if (filenames.size() != 3) {
+    if (filenames.size() != ARGUMENTS) {
         std::cerr << "Not enough space in the vector" << std::endl;
         exit(EXIT_FAILURE);
     }
@@ -56,6 +88,26 @@ std::vector<std::string> &parseCmdline(int argc, char *argv[],
                 filenames[2] = optarg;
                 break;
 
+            case OPTION_C:
+                filenames[3] = optarg;
+                break;
+
+            case OPTION_B:
+                filenames[4] = optarg;
+                break;
+
+            case OPTION_S:
+                filenames[5] = optarg;
+                break;
+
+            case OPTION_F:
+                filenames[6] = optarg;
+                break;
+
+            case OPTION_K:
+                filenames[7] = optarg;
+                break;
+
             case '?':
                 showError();
 
@@ -74,14 +126,17 @@ std::vector<std::string> &parseCmdline(int argc, char *argv[],
 }
 
 std::vector<std::string> parseCmdline(int argc, char *argv[]) {
-    std::vector<std::string> filenames = {DICTIONARY, INPUT, OUTPUT};
+    std::vector<std::string> filenames = {DICTIONARY, INPUT, OUTPUT, CACHE, BACKENDS,
+                                              ENGINE, FILTER, DISTANCE};
     return parseCmdline(argc, argv, filenames);
 }
 
 void showError() {
     unsigned char option = optopt;
 
-    if (option == OPTION_D || option == OPTION_I || option == OPTION_O)
+    if (option == OPTION_D || option == OPTION_I || option == OPTION_O
+        || option == OPTION_C || option == OPTION_B || option == OPTION_S
+        || option == OPTION_F || option == OPTION_K)
         std::cerr << "Option '-" << option << "' requires an argument."
                   << std::endl;
     else if (isprint(option))
@@ -132,6 +187,56 @@ std::string &strSanitize(std::string &str) {
     return strTolower(str);
 }
 
+std::vector<std::string> loadSortedWords(const std::string &filename) {
+    std::string line;
+    std::ifstream stream(filename);
+    std::vector<std::string> words;
+
+    while (std::getline(stream, line))
+        if (!strSanitize(line).empty())
+            words.push_back(line);
+
+    stream.close();
+
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+
+    return words;
+}
+
+/**
+* @fn size_t stringMemoryUsage(const std::string& str)
+* @brief Obtient la mémoire occupée par une chaîne, avec ses caractères
+*        s'ils ne sont pas rangés dans la chaîne elle-même.
+*/
+static size_t stringMemoryUsage(const std::string &str) {
+    const char *begin = reinterpret_cast<const char *>(&str);
+    const bool INLINE = str.data() >= begin && str.data() < begin + sizeof(str);
+
+    return sizeof(std::string) + (INLINE ? 0 : str.capacity() + 1);
+}
+
+size_t memoryUsage(const std::unordered_set<std::string> &words) {
+    // Noeud : lien vers le suivant, mot et empreinte conservée
+    size_t bytes = words.bucket_count() * sizeof(void *)
+                   + words.size() * (sizeof(void *) + sizeof(size_t));
+
+    for (const std::string &word : words)
+        bytes += stringMemoryUsage(word);
+
+    return bytes;
+}
+
+size_t memoryUsage(const std::set<std::string> &words) {
+    // Noeud : parent, enfants gauche et droit, couleur et mot
+    size_t bytes = words.size() * 4 * sizeof(void *);
+
+    for (const std::string &word : words)
+        bytes += stringMemoryUsage(word);
+
+    return bytes;
+}
+
 std::string &strTolower(std::string &str) {
     std::transform(str.begin(), str.end(), str.begin(), tolower);
     return str;
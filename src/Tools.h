@@ -9,7 +9,9 @@
 
 #pragma once
 
+#include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 /**
@@ -21,7 +23,13 @@
 *    
 * @param[in] argc		nombre d'arguments contenu dans argv
 * @param[in] argv		tableau contenant des arguments
-* @param[in] tokens  tableau contenant les noms des fichiers
+* @param[in] tokens  tableau contenant les noms des fichiers : dictionnaire,
+*                    texte à corriger, sortie, dossier des dictionnaires
+*                    compilés, la liste des types de dictionnaire à
+*                    utiliser séparés par des virgules, le moteur de
+*                    suggestions, le taux de faux positifs du filtre des
+*                    corrections, puis la distance d'édition maximale des
+*                    corrections
 *
 * @return tableau contenant les noms des fichiers.
 */
@@ -86,6 +94,41 @@ std::vector<std::string> split(const std::string &str, const std::string &delims
 */
 std::string &strSanitize(std::string &str);
 
+/**
+* @fn std::vector<std::string> loadSortedWords(const std::string& filename)
+* @brief Lit les mots d'un fichier dictionnaire, un par ligne, nettoyés par
+*        strSanitize, triés et sans doublon. Les lignes vides sont ignorées.
+*
+* @param[in] filename    nom du fichier dictionnaire
+*
+* @return tableau des mots triés.
+*/
+std::vector<std::string> loadSortedWords(const std::string &filename);
+
+/**
+* @fn size_t memoryUsage(const std::unordered_set<std::string>& words)
+* @brief Estime la mémoire réservée par un ensemble de mots : ses alvéoles,
+*        ses noeuds et les caractères des mots trop longs pour être rangés
+*        dans la chaîne elle-même.
+*
+* @param[in] words    ensemble de mots
+*
+* @return nombre d'octets réservés.
+*/
+size_t memoryUsage(const std::unordered_set<std::string> &words);
+
+/**
+* @fn size_t memoryUsage(const std::set<std::string>& words)
+* @brief Estime la mémoire réservée par un ensemble ordonné de mots : ses
+*        noeuds et les caractères des mots trop longs pour être rangés dans
+*        la chaîne elle-même.
+*
+* @param[in] words    ensemble de mots
+*
+* @return nombre d'octets réservés.
+*/
+size_t memoryUsage(const std::set<std::string> &words);
+
 /**
 * @fn std::string& strTolower(std::string& str)
 * @brief Transforme la chaîne de caractères en minuscule.
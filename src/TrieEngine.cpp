@@ -0,0 +1,26 @@
+/**
+*  @file TrieEngine.cpp
+*  @brief Modélise un moteur de suggestions qui parcourt un arbre ternaire de
+*         recherche avec un budget d'une erreur.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#include "TrieEngine.h"
+
+TrieEngine::TrieEngine(const std::string &filename) : tree(filename) {
+}
+
+void TrieEngine::suggest(const std::string &word, std::vector<Correction> &corrections) {
+    tree.suggest(word, corrections);
+}
+
+size_t TrieEngine::countNodes() const {
+    return tree.nodeCount();
+}
+
+size_t TrieEngine::memoryUsage() const {
+    return tree.memoryUsage();
+}
@@ -0,0 +1,71 @@
+/**
+*  @file TrieEngine.h
+*  @brief Modélise un moteur de suggestions qui parcourt un arbre ternaire de
+*         recherche avec un budget d'une erreur.
+*
+*  @author Damien Carnal, Matthieu Chatelan, Loan Lassalle
+*  @date 17 October 2026
+*  @version 1.0
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "DictionaryTree.h"
+#include "ISuggestionEngine.h"
+
+/**
+* Plutôt que de chercher dans le dictionnaire chacun des 54n + 25 mots
+* générés, le moteur suit une seule fois le mot dans l'arbre. A chaque
+* position, l'erreur est placée sur le préfixe déjà suivi et seuls les
+* caractères présents dans l'arbre sont essayés comme lettre ajoutée ou
+* remplacée. Le parcours s'arrête dès que le préfixe n'est plus dans l'arbre.
+*/
+class TrieEngine : public ISuggestionEngine {
+public:
+    /**
+    * @fn TrieEngine(const std::string& filename)
+    * @brief Constructeur du moteur avec le nom du fichier du dictionnaire.
+    *        Les mots ajoutés ou supprimés du dictionnaire par la suite ne
+    *        sont pas pris en compte.
+    *
+    * @param[in] filename      nom du fichier du dictionnaire
+    */
+    TrieEngine(const std::string &filename);
+
+    /**
+    * @fn void suggest(const std::string& word,
+    *                  std::vector<Correction>& corrections)
+    * @brief Ajoute les corrections du mot à distance d'édition 1, dans
+    *        l'ordre de Correction.
+    *
+    * @param[in] word           mot mal orthographié, nettoyé
+    * @param[out] corrections   tableau auquel ajouter les corrections
+    */
+    void suggest(const std::string &word, std::vector<Correction> &corrections);
+
+    /**
+    * @fn size_t countNodes() const
+    * @brief Obtient le nombre de noeuds de l'arbre parcouru.
+    *
+    * @return nombre de noeuds.
+    */
+    size_t countNodes() const;
+
+    /**
+    * @fn size_t memoryUsage() const
+    * @brief Obtient la mémoire utilisée par l'arbre parcouru.
+    *
+    * @return nombre d'octets utilisés.
+    */
+    size_t memoryUsage() const;
+
+private:
+    /**
+    * @var   DictionaryFlatTree tree
+    * @brief Arbre des mots du dictionnaire.
+    */
+    DictionaryFlatTree tree;
+};
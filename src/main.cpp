@@ -11,66 +11,607 @@
  * Created on 22. decembre 2016
  */
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 
+#include "BitParallelEngine.h"
+#include "BloomFilter.h"
+#include "DictionaryArt.h"
+#include "DictionaryCached.h"
+#include "DictionaryDawg.h"
+#include "DictionaryEytzinger.h"
+#include "DictionaryHash.h"
+#include "DictionaryHatTrie.h"
+#include "DictionaryLouds.h"
+#include "DictionaryPacked.h"
+#include "DictionaryPerfectHash.h"
+#include "DictionarySearchTree.h"
 #include "DictionarySet.h"
 #include "DictionaryTree.h"
+#ifdef EMBEDDED_DICTIONARY
+#include "DictionaryEmbedded.h"
+#endif
+#include "LevenshteinEngine.h"
 #include "Spellchecker.h"
+#include "SymSpellEngine.h"
+#include "TrieEngine.h"
 
 #define TIME_UNIT " ms"
+#define LOOKUP_UNIT " ns/op"
+#define MEMORY_UNIT " bytes"
 #define OUTPUT_SET "output_dictionarySet.txt"
+#define OUTPUT_HASH "output_dictionaryHash.txt"
+#define OUTPUT_PERFECT_HASH "output_dictionaryPerfectHash.txt"
+#define OUTPUT_PACKED "output_dictionaryPacked.txt"
 #define OUTPUT_TREE "output_dictionaryTree.txt"
+#define OUTPUT_EYTZINGER "output_dictionaryEytzinger.txt"
+#define OUTPUT_ART "output_dictionaryArt.txt"
+#define OUTPUT_HAT_TRIE "output_dictionaryHatTrie.txt"
+#define OUTPUT_FLAT_TREE "output_dictionaryFlatTree.txt"
+#define OUTPUT_AVL "output_dictionaryAVL.txt"
+#define OUTPUT_BST "output_dictionaryBST.txt"
+#define OUTPUT_DAWG "output_dictionaryDawg.txt"
+#define OUTPUT_LOUDS "output_dictionaryLouds.txt"
+#define OUTPUT_CACHED "output_dictionaryCached.txt"
+#define OUTPUT_EMBEDDED "output_dictionaryEmbedded.txt"
+
+// Types de dictionnaire disponibles, dans l'ordre d'exécution
+#ifdef EMBEDDED_DICTIONARY
+#define ALL_BACKENDS "set,hash,perfect,packed,tree,eytzinger,art,hat,flat,avl,bst,dawg,louds,cached,embedded"
+#else
+#define ALL_BACKENDS "set,hash,perfect,packed,tree,eytzinger,art,hat,flat,avl,bst,dawg,louds,cached"
+#endif
+
+// Moteurs de suggestions disponibles
+#define ENGINE_GENERATE "generate"
+#define ENGINE_SYMSPELL "symspell"
+#define ENGINE_TRIE "trie"
+#define ENGINE_LEVENSHTEIN "levenshtein"
+#define ENGINE_MYERS "myers"
 
 using namespace std;
 
-int main(int argc, char *argv[]) {
-    // Récupération des arguments de la ligne de commande
-    vector<string> filenames(parseCmdline(argc, argv));
+/**
+* @fn vector<string> loadWords(const string& filename)
+* @brief Obtient les mots nettoyés d'un fichier, tels que le correcteur
+*        orthographique les recherche.
+*
+* @param[in] filename   nom du fichier à lire
+*
+* @return tableau des mots du fichier.
+*/
+vector<string> loadWords(const string &filename) {
+    vector<string> words;
+    ifstream stream(filename);
+    string line;
 
-    // Spellchecker avec un DictionarySet
+    while (getline(stream, line))
+        for (string &word : split(line, DELIMITERS))
+            if (!strSanitize(word).empty())
+                words.push_back(word);
 
-    // Création du DictionarySet
-    auto t1_1 = chrono::high_resolution_clock::now();
-    DictionarySet dictionarySet(filenames[0]);
-    auto t2_1 = chrono::high_resolution_clock::now();
+    return words;
+}
 
-    Spellchecker spellcheckerSet(dictionarySet);
+/**
+* @fn vector<string> loadMisses(const vector<string>& words)
+* @brief Obtient des mots à rechercher en majorité absents du dictionnaire,
+*        comme les corrections essayées par le correcteur orthographique :
+*        chaque mot du texte avec une de ses lettres remplacée par la
+*        suivante dans l'alphabet.
+*
+* @param[in] words   mots du texte
+*
+* @return tableau des mots modifiés.
+*/
+vector<string> loadMisses(const vector<string> &words) {
+    vector<string> misses;
 
-    // Correction du texte avec le DictionarySet
-    auto t3_1 = chrono::high_resolution_clock::now();
-    spellcheckerSet.checkFile(filenames[1], OUTPUT_SET);
-    auto t4_1 = chrono::high_resolution_clock::now();
+    for (const string &word : words)
+        for (size_t i = 0; i < word.length(); ++i) {
+            string miss(word);
+            miss[i] = miss[i] >= 'a' && miss[i] < 'z' ? miss[i] + 1 : 'a';
+            misses.push_back(miss);
+        }
 
-    // Affichage des temps pour le DictionarySet
-    auto creationTime_1 = chrono::duration_cast<chrono::milliseconds>(t2_1 - t1_1).count();
-    auto checkTime_1 = chrono::duration_cast<chrono::milliseconds>(t4_1 - t3_1).count();
-    cout << "DictionarySet" << endl
-         << "Creation of dictionary : " << creationTime_1 << TIME_UNIT << endl
-         << "Spelling correction    : " << checkTime_1 << TIME_UNIT << endl
-         << endl;
+    return misses;
+}
 
-    // Spellchecker avec un DictionaryTree
+/**
+* @fn double lookupTime(IDictionary& dictionary, const vector<string>& words)
+* @brief Mesure le temps moyen d'une recherche dans le dictionnaire.
+*
+* @param[in] dictionary  dictionnaire utilisé
+* @param[in] words       mots à rechercher
+*
+* @return temps moyen d'une recherche en nanosecondes.
+*/
+double lookupTime(IDictionary &dictionary, const vector<string> &words) {
+    if (words.empty())
+        return 0;
 
-    // Création du DictionaryTree
-    auto t1_2 = chrono::high_resolution_clock::now();
-    DictionaryTree dictionaryTree(filenames[0]);
-    auto t2_2 = chrono::high_resolution_clock::now();
+    size_t found = 0;
 
-    Spellchecker spellcheckerTree(dictionaryTree);
+    auto t1 = chrono::high_resolution_clock::now();
+    for (const string &word : words)
+        found += dictionary.contains(word);
+    auto t2 = chrono::high_resolution_clock::now();
 
-    // Correction du texte avec le DictionaryTree
-    auto t3_2 = chrono::high_resolution_clock::now();
-    spellcheckerTree.checkFile(filenames[1], OUTPUT_TREE);
-    auto t4_2 = chrono::high_resolution_clock::now();
+    // Empêche le compilateur d'ignorer les recherches
+    volatile size_t sink = found;
+    (void) sink;
 
-    // Affichage des temps pour le DictionaryTree
-    auto creationTime_2 = chrono::duration_cast<chrono::milliseconds>(t2_2 - t1_2).count();
-    auto checkTime_2 = chrono::duration_cast<chrono::milliseconds>(t4_2 - t3_2).count();
-    cout << "DictionaryTree" << endl
-         << "Creation of dictionary : " << creationTime_2 << TIME_UNIT << endl
-         << "Spelling correction    : " << checkTime_2 << TIME_UNIT;
+    return chrono::duration<double, nano>(t2 - t1).count() / words.size();
+}
 
-    return EXIT_SUCCESS;
+/**
+* @fn void showStatistics(const IDictionary& dictionary)
+* @brief Affiche les statistiques propres au type de dictionnaire.
+*/
+void showStatistics(const IDictionary &) {}
+
+/**
+* @fn template <typename TreeType>
+*     void showStatistics(const BasicDictionaryTree<TreeType>& dictionary)
+* @brief Affiche la hauteur, le nombre de noeuds et la mémoire utilisée par
+*        noeud de l'arbre du dictionnaire.
+*/
+template<typename TreeType>
+void showStatistics(const BasicDictionaryTree<TreeType> &dictionary) {
+    const size_t nodes = dictionary.nodeCount();
+
+    cout << "Height                 : " << dictionary.height() << endl
+         << "Nodes                  : " << nodes << endl
+         << "Memory per node        : "
+         << (nodes ? dictionary.memoryUsage() / (double) nodes : 0)
+         << MEMORY_UNIT << endl;
+}
+
+/**
+* @fn template <typename TreeType>
+*     void showStatistics(const BasicDictionarySearchTree<TreeType>& dictionary)
+* @brief Affiche la hauteur de l'arbre du dictionnaire et son mot médian,
+*        obtenu par rang.
+*/
+template<typename TreeType>
+void showStatistics(const BasicDictionarySearchTree<TreeType> &dictionary) {
+    cout << "Height                 : " << dictionary.height() << endl;
+
+    if (!dictionary.empty())
+        cout << "Median word            : "
+             << dictionary.select(dictionary.size() / 2) << endl;
+}
+
+/**
+* @fn void showStatistics(const DictionaryHash& dictionary)
+* @brief Affiche le nombre de cases et le taux de remplissage de la table du
+*        dictionnaire.
+*/
+void showStatistics(const DictionaryHash &dictionary) {
+    const FlatHashSet &set = dictionary.getSet();
+
+    cout << "Slots                  : " << set.capacity() << endl
+         << "Load factor            : "
+         << (set.capacity() ? set.size() / (double) set.capacity() : 0) << endl;
+}
+
+/**
+* @fn void showStatistics(const DictionaryPerfectHash& dictionary)
+* @brief Affiche le nombre de paquets de la fonction de hachage et la
+*        mémoire utilisée par mot.
+*/
+void showStatistics(const DictionaryPerfectHash &dictionary) {
+    const PerfectHashSet &set = dictionary.getSet();
+
+    cout << "Buckets                : " << set.countBuckets() << endl
+         << "Memory per word        : "
+         << (set.size() ? set.memoryUsage() / (double) set.size() : 0)
+         << MEMORY_UNIT << endl;
+}
+
+/**
+* @fn void showStatistics(const DictionaryEytzinger& dictionary)
+* @brief Affiche le nombre de niveaux du tableau du dictionnaire, la mémoire
+*        utilisée par mot et le temps d'un parcours de tous les mots dans
+*        l'ordre alphabétique.
+*/
+void showStatistics(const DictionaryEytzinger &dictionary) {
+    const EytzingerArray &array = dictionary.getArray();
+
+    auto t1 = chrono::high_resolution_clock::now();
+    const size_t words = dictionary.words().size();
+    auto t2 = chrono::high_resolution_clock::now();
+
+    cout << "Levels                 : " << array.countLevels() << endl
+         << "Memory per word        : "
+         << (array.size() ? array.memoryUsage() / (double) array.size() : 0)
+         << MEMORY_UNIT << endl
+         << "Ordered scan           : "
+         << chrono::duration<double, milli>(t2 - t1).count() << TIME_UNIT
+         << " (" << words << " words)" << endl;
+}
+
+/**
+* @fn void showStatistics(const DictionaryArt& dictionary)
+* @brief Affiche le nombre de noeuds internes de chaque type de l'arbre du
+*        dictionnaire et la mémoire utilisée par mot.
+*/
+void showStatistics(const DictionaryArt &dictionary) {
+    const AdaptiveRadixTree &tree = dictionary.getTree();
+
+    cout << "Nodes (4/16/48/256)    : " << tree.countNodes(4) << "/"
+         << tree.countNodes(16) << "/" << tree.countNodes(48) << "/"
+         << tree.countNodes(256) << endl
+         << "Memory per word        : "
+         << (tree.size() ? tree.memoryUsage() / (double) tree.size() : 0)
+         << MEMORY_UNIT << endl;
+}
+
+/**
+* @fn void showStatistics(const DictionaryHatTrie& dictionary)
+* @brief Affiche le nombre de noeuds et de paquets du trie du dictionnaire et
+*        la mémoire utilisée par mot.
+*/
+void showStatistics(const DictionaryHatTrie &dictionary) {
+    const HatTrie &trie = dictionary.getTrie();
+
+    cout << "Nodes                  : " << trie.countNodes() << endl
+         << "Buckets                : " << trie.countBuckets() << endl
+         << "Memory per word        : "
+         << (trie.size() ? trie.memoryUsage() / (double) trie.size() : 0)
+         << MEMORY_UNIT << endl;
+}
+
+/**
+* @fn void showStatistics(const DictionaryPacked& dictionary)
+* @brief Affiche la part des mots rangés dans des clés et le taux de
+*        remplissage de la table des clés du dictionnaire.
+*/
+void showStatistics(const DictionaryPacked &dictionary) {
+    const PackedWordSet &set = dictionary.getSet();
+
+    cout << "Packed words           : " << set.countPacked() << " / " << set.size()
+         << endl
+         << "Load factor            : "
+         << (set.capacity() ? set.countPacked() / (double) set.capacity() : 0) << endl;
+}
+
+/**
+* @fn void showStatistics(const DictionaryDawg& dictionary)
+* @brief Affiche le nombre d'états et de transitions de l'automate du
+*        dictionnaire.
+*/
+void showStatistics(const DictionaryDawg &dictionary) {
+    cout << "States                 : " << dictionary.getDawg().countStates() << endl
+         << "Edges                  : " << dictionary.getDawg().countEdges() << endl;
+}
+
+/**
+* @fn void showStatistics(const DictionaryLouds& dictionary)
+* @brief Affiche le nombre de noeuds du trie du dictionnaire et la mémoire
+*        utilisée par noeud, en bits.
+*/
+void showStatistics(const DictionaryLouds &dictionary) {
+    const size_t nodes = dictionary.getLouds().countNodes();
+
+    cout << "Nodes                  : " << nodes << endl
+         << "Bits per node          : "
+         << (nodes ? 8.0 * dictionary.memoryUsage() / nodes : 0) << endl;
+}
+
+/**
+* @fn template <typename Dictionary, typename... Arguments>
+*     void benchmark(const string& name, const string& filenameCheck,
+*                    const string& filenameOutput, const vector<string>& words,
+*                    const vector<string>& misses, ISuggestionEngine* engine,
+*                    const BloomFilter* filter, const Arguments&... arguments)
+* @brief Crée le dictionnaire, corrige le texte et affiche les temps de
+*        création, de correction et de recherche.
+*
+* @param[in] name            nom du type de dictionnaire
+* @param[in] filenameCheck   nom du fichier à corriger
+* @param[in] filenameOutput  nom du fichier de sortie
+* @param[in] words           mots du texte, pour mesurer les recherches
+* @param[in] misses          mots en majorité absents, pour mesurer les échecs
+* @param[in] engine          moteur de suggestions, nul pour aucun
+* @param[in] filter          filtre des corrections, nul pour aucun
+* @param[in] arguments       arguments du constructeur du dictionnaire
+*/
+template<typename Dictionary, typename... Arguments>
+void benchmark(const string &name, const string &filenameCheck,
+               const string &filenameOutput, const vector<string> &words,
+               const vector<string> &misses, ISuggestionEngine *engine,
+               const BloomFilter *filter, const Arguments &... arguments) {
+    // Création du dictionnaire
+    auto t1 = chrono::high_resolution_clock::now();
+    Dictionary dictionary(arguments...);
+    auto t2 = chrono::high_resolution_clock::now();
+
+    Spellchecker spellchecker(dictionary);
+    spellchecker.setEngine(engine);
+    spellchecker.setFilter(filter);
+
+    // Correction du texte avec le dictionnaire
+    auto t3 = chrono::high_resolution_clock::now();
+    spellchecker.checkFile(filenameCheck, filenameOutput);
+    auto t4 = chrono::high_resolution_clock::now();
+
+    // Affichage des temps pour le dictionnaire
+    auto creationTime = chrono::duration_cast<chrono::milliseconds>(t2 - t1).count();
+    auto checkTime = chrono::duration_cast<chrono::milliseconds>(t4 - t3).count();
+    cout << name << endl
+         << "Creation of dictionary : " << creationTime << TIME_UNIT << endl
+         << "Spelling correction    : " << checkTime << TIME_UNIT << endl
+         << "Lookup (contains)      : " << lookupTime(dictionary, words)
+         << LOOKUP_UNIT << endl
+         << "Lookup (misses)        : " << lookupTime(dictionary, misses)
+         << LOOKUP_UNIT << endl
+         << "Memory usage           : " << dictionary.memoryUsage()
+         << MEMORY_UNIT << endl;
+
+    showStatistics(dictionary);
+    cout << endl;
+}
+
+/**
+* @fn vector<string> selectBackends(const string& list)
+* @brief Obtient les types de dictionnaire demandés. Quitte le programme si
+*        un type est inconnu.
+*
+* @param[in] list   types séparés par des virgules, vide pour tous
+*
+* @return tableau des types de dictionnaire à utiliser.
+*/
+vector<string> selectBackends(const string &list) {
+    const vector<string> available(split(ALL_BACKENDS, ","));
+    vector<string> backends(split(list.empty() ? ALL_BACKENDS : list, ","));
+
+    for (const string &backend : backends)
+        if (find(available.begin(), available.end(), backend) == available.end()) {
+            cerr << "Unknown dictionary type '" << backend << "', expected one of "
+                 << ALL_BACKENDS << "." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+    return backends;
 }
 
+/**
+* @fn ISuggestionEngine* createEngine(const string& name,
+*                                    const string& filename,
+*                                    const string& distance)
+* @brief Crée le moteur de suggestions demandé et affiche son temps de
+*        création. Quitte le programme si le moteur est inconnu ou si la
+*        distance n'est pas un entier positif.
+*
+* @param[in] name       nom du moteur
+* @param[in] filename   nom du fichier du dictionnaire
+* @param[in] distance   distance d'édition maximale des corrections, seul
+*                       les moteurs levenshtein et myers dépassent la
+*                       distance 1
+*
+* @return moteur créé, nul pour générer les corrections.
+*/
+ISuggestionEngine *createEngine(const string &name, const string &filename,
+                                const string &distance) {
+    const unsigned long maxDistance = strtoul(distance.c_str(), nullptr, 10);
+
+    if (distance.find_first_not_of("0123456789") != string::npos || maxDistance == 0) {
+        cerr << "Invalid edit distance '" << distance
+             << "', expected a positive integer." << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (maxDistance > 1 && name != ENGINE_LEVENSHTEIN && name != ENGINE_MYERS) {
+        cerr << "Edit distance " << distance << " requires the "
+             << ENGINE_LEVENSHTEIN << " or " << ENGINE_MYERS
+             << " suggestion engine." << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (name == ENGINE_GENERATE)
+        return nullptr;
+
+    if (name == ENGINE_LEVENSHTEIN) {
+        auto t1 = chrono::high_resolution_clock::now();
+        LevenshteinEngine *engine = new LevenshteinEngine(filename, maxDistance);
+        auto t2 = chrono::high_resolution_clock::now();
+
+        cout << "LevenshteinEngine" << endl
+             << "Creation of automaton  : "
+             << chrono::duration_cast<chrono::milliseconds>(t2 - t1).count()
+             << TIME_UNIT << endl
+             << "Edit distance          : " << engine->getDistance() << endl
+             << "States                 : " << engine->countStates() << endl
+             << "Memory usage           : " << engine->memoryUsage() << MEMORY_UNIT
+             << endl << endl;
+
+        return engine;
+    }
+
+    if (name == ENGINE_MYERS) {
+        auto t1 = chrono::high_resolution_clock::now();
+        BitParallelEngine *engine = new BitParallelEngine(filename, maxDistance);
+        auto t2 = chrono::high_resolution_clock::now();
+
+        cout << "BitParallelEngine" << endl
+             << "Creation of buckets    : "
+             << chrono::duration_cast<chrono::milliseconds>(t2 - t1).count()
+             << TIME_UNIT << endl
+             << "Edit distance          : " << engine->getDistance() << endl
+             << "Words                  : " << engine->countWords() << endl
+             << "Memory usage           : " << engine->memoryUsage() << MEMORY_UNIT
+             << endl << endl;
+
+        return engine;
+    }
+
+    if (name == ENGINE_TRIE) {
+        auto t1 = chrono::high_resolution_clock::now();
+        TrieEngine *engine = new TrieEngine(filename);
+        auto t2 = chrono::high_resolution_clock::now();
+
+        cout << "TrieEngine" << endl
+             << "Creation of tree       : "
+             << chrono::duration_cast<chrono::milliseconds>(t2 - t1).count()
+             << TIME_UNIT << endl
+             << "Nodes                  : " << engine->countNodes() << endl
+             << "Memory usage           : " << engine->memoryUsage() << MEMORY_UNIT
+             << endl << endl;
+
+        return engine;
+    }
+
+    if (name != ENGINE_SYMSPELL) {
+        cerr << "Unknown suggestion engine '" << name << "', expected "
+             << ENGINE_GENERATE << ", " << ENGINE_SYMSPELL << ", " << ENGINE_TRIE
+             << ", " << ENGINE_LEVENSHTEIN << " or " << ENGINE_MYERS << "." << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    auto t1 = chrono::high_resolution_clock::now();
+    SymSpellEngine *engine = new SymSpellEngine(filename);
+    auto t2 = chrono::high_resolution_clock::now();
+
+    cout << "SymSpellEngine" << endl
+         << "Creation of index      : "
+         << chrono::duration_cast<chrono::milliseconds>(t2 - t1).count()
+         << TIME_UNIT << endl
+         << "Keys                   : " << engine->countKeys() << endl
+         << "Memory usage           : " << engine->memoryUsage() << MEMORY_UNIT
+         << endl << endl;
+
+    return engine;
+}
+
+/**
+* @fn BloomFilter* createFilter(const string& rate, const string& filename)
+* @brief Crée le filtre des corrections avec les mots du dictionnaire et
+*        affiche sa taille et son taux de faux positifs mesuré. Quitte le
+*        programme si le taux n'est pas dans ]0, 1[.
+*
+* @param[in] rate       taux de faux positifs visé, vide pour aucun filtre
+* @param[in] filename   nom du fichier du dictionnaire
+*
+* @return filtre créé, nul si aucun filtre n'est demandé.
+*/
+BloomFilter *createFilter(const string &rate, const string &filename) {
+    if (rate.empty())
+        return nullptr;
+
+    char *end;
+    const double falsePositiveRate = strtod(rate.c_str(), &end);
+
+    if (*end || !(falsePositiveRate > 0 && falsePositiveRate < 1)) {
+        cerr << "Invalid false positive rate '" << rate
+             << "', expected a number between 0 and 1." << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    // Mots du dictionnaire, nettoyés comme par les dictionnaires
+    vector<string> entries(loadSortedWords(filename));
+
+    auto t1 = chrono::high_resolution_clock::now();
+    BloomFilter *filter = new BloomFilter();
+    filter->build(entries, falsePositiveRate);
+    auto t2 = chrono::high_resolution_clock::now();
+
+    // Taux mesuré sur des mots absents : '#' n'est jamais gardé par
+    // strSanitize.
+    const size_t TRIALS = 100000;
+    size_t positives = 0;
+    for (size_t i = 0; i < TRIALS; ++i)
+        positives += filter->mayContain("#" + to_string(i));
+
+    cout << "BloomFilter" << endl
+         << "Creation of filter     : "
+         << chrono::duration_cast<chrono::milliseconds>(t2 - t1).count()
+         << TIME_UNIT << endl
+         << "Target FP rate         : " << falsePositiveRate << endl
+         << "Measured FP rate       : " << positives / (double) TRIALS << endl
+         << "Hashes                 : " << filter->countHashes() << endl
+         << "Bits per word          : "
+         << (entries.empty() ? 0 : filter->countBits() / (double) entries.size())
+         << endl
+         << "Memory usage           : " << filter->memoryUsage() << MEMORY_UNIT
+         << endl << endl;
+
+    return filter;
+}
+
+int main(int argc, char *argv[]) {
+    // Récupération des arguments de la ligne de commande
+    vector<string> filenames(parseCmdline(argc, argv));
+
+    // Mots du texte à corriger, pour mesurer le temps des recherches
+    vector<string> words(loadWords(filenames[1]));
+    vector<string> misses(loadMisses(words));
+
+    const string &dictionary = filenames[0];
+    const string &check = filenames[1];
+    const string &cache = filenames[3];
+
+    ISuggestionEngine *engine = createEngine(filenames[5], dictionary,
+                                             filenames[7]);
+    BloomFilter *filter = createFilter(filenames[6], dictionary);
+
+    for (const string &backend : selectBackends(filenames[4])) {
+        if (backend == "set")
+            benchmark<DictionarySet>("DictionarySet", check, OUTPUT_SET,
+                                     words, misses, engine, filter, dictionary);
+        else if (backend == "hash")
+            benchmark<DictionaryHash>("DictionaryHash", check, OUTPUT_HASH,
+                                      words, misses, engine, filter, dictionary);
+        else if (backend == "perfect")
+            benchmark<DictionaryPerfectHash>("DictionaryPerfectHash", check,
+                                             OUTPUT_PERFECT_HASH, words, misses,
+                                             engine, filter, dictionary);
+        else if (backend == "packed")
+            benchmark<DictionaryPacked>("DictionaryPacked", check, OUTPUT_PACKED,
+                                        words, misses, engine, filter, dictionary);
+        else if (backend == "tree")
+            benchmark<DictionaryTree>("DictionaryTree", check, OUTPUT_TREE,
+                                      words, misses, engine, filter, dictionary);
+        else if (backend == "eytzinger")
+            benchmark<DictionaryEytzinger>("DictionaryEytzinger", check, OUTPUT_EYTZINGER,
+                                           words, misses, engine, filter, dictionary);
+        else if (backend == "art")
+            benchmark<DictionaryArt>("DictionaryArt", check, OUTPUT_ART,
+                                     words, misses, engine, filter, dictionary);
+        else if (backend == "hat")
+            benchmark<DictionaryHatTrie>("DictionaryHatTrie", check, OUTPUT_HAT_TRIE,
+                                         words, misses, engine, filter, dictionary);
+        else if (backend == "flat")
+            benchmark<DictionaryFlatTree>("DictionaryFlatTree", check, OUTPUT_FLAT_TREE,
+                                          words, misses, engine, filter, dictionary);
+        else if (backend == "avl")
+            benchmark<DictionaryAVL>("DictionaryAVL", check, OUTPUT_AVL,
+                                     words, misses, engine, filter, dictionary);
+        else if (backend == "bst")
+            benchmark<DictionaryBST>("DictionaryBST", check, OUTPUT_BST,
+                                     words, misses, engine, filter, dictionary);
+        else if (backend == "dawg")
+            benchmark<DictionaryDawg>("DictionaryDawg", check, OUTPUT_DAWG,
+                                      words, misses, engine, filter, dictionary);
+        else if (backend == "louds")
+            benchmark<DictionaryLouds>("DictionaryLouds", check, OUTPUT_LOUDS,
+                                       words, misses, engine, filter, dictionary);
+        else if (backend == "cached")
+            benchmark<DictionaryCached>("DictionaryCached", check, OUTPUT_CACHED,
+                                        words, misses, engine, filter, dictionary,
+                                        cache);
+#ifdef EMBEDDED_DICTIONARY
+        else if (backend == "embedded")
+            benchmark<DictionaryEmbedded>("DictionaryEmbedded", check, OUTPUT_EMBEDDED,
+                                          words, misses, engine, filter);
+#endif
+    }
+
+    delete engine;
+    delete filter;
+
+    return EXIT_SUCCESS;
+}
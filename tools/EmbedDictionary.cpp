@@ -0,0 +1,76 @@
+/*
+ * File:         EmbedDictionary.cpp
+ * Authors:      Damien Carnal, Matthieu Chatelan, Loan Lassalle
+ * Description:  Compile un dictionnaire texte et produit un fichier source
+ *               contenant son image binaire, intégrée à l'exécutable pour
+ *               DictionaryEmbedded.
+ *
+ *               Utilisation : EmbedDictionary <dictionnaire> <source.cpp>
+ *
+ * Created on 17. october 2026
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "DictionaryTree.h"
+
+// Nombre d'octets écrits par ligne du tableau.
+#define BYTES_PER_LINE 16
+
+using namespace std;
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        cerr << "Usage: " << argv[0] << " <dictionary> <output.cpp>" << endl;
+        return EXIT_FAILURE;
+    }
+
+    const string source(argv[1]);
+    const string output(argv[2]);
+    const string image = output + ".bin";
+
+    // Compilation de l'image binaire du dictionnaire
+    if (!DictionaryFlatTree(source).save(image)) {
+        cerr << "Cannot write " << image << "." << endl;
+        return EXIT_FAILURE;
+    }
+
+    ifstream input(image, ios_base::binary);
+    vector<unsigned char> bytes((istreambuf_iterator<char>(input)),
+                                istreambuf_iterator<char>());
+    input.close();
+    remove(image.c_str());
+
+    ofstream stream(output, ios_base::trunc);
+
+    stream << "// Fichier produit par EmbedDictionary depuis " << source << endl
+           << "// Ne pas modifier." << endl << endl
+           << "#include <cstddef>" << endl << endl
+           << "extern const char embeddedDictionarySource[] = \"";
+
+    for (char c : source)
+        stream << (c == '"' || c == '\\' ? "\\" : "") << c;
+
+    stream << "\";" << endl << endl
+           << "extern const size_t embeddedDictionarySize = " << bytes.size() << ";"
+           << endl << endl
+           << "alignas(8) extern const unsigned char embeddedDictionaryImage[] = {";
+
+    char hex[8];
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        if (i % BYTES_PER_LINE == 0)
+            stream << endl << "   ";
+
+        snprintf(hex, sizeof(hex), " 0x%02x,", bytes[i]);
+        stream << hex;
+    }
+
+    stream << endl << "};" << endl;
+    stream.close();
+
+    return stream.fail() ? EXIT_FAILURE : EXIT_SUCCESS;
+}